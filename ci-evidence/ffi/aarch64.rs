@@ -0,0 +1,157 @@
+// aarch64 multi-buffer kernel (aarch64 library)
+// nano_sha3_256_x2: 2 states in NEON q registers, Keccak rounds on the
+// ARMv8.2-SHA3 instructions (EOR3, RAX1, XAR, BCAX). The same Lanes type
+// runs single messages in ffi/dispatch.rs.
+// CPUs without FEAT_SHA3 fall back to the scalar permutation.
+
+use core::arch::aarch64::*;
+
+use super::keccak::{Lanes, Word};
+use super::multibuf::{
+    keccak_batches, node64_level, sha3_256_lanes, sha3_256_scalar, xof_absorb_x4, xof_squeeze_x4, XofX4,
+};
+
+#[derive(Clone, Copy)]
+pub struct Sha3Neon(uint64x2_t);
+
+impl Lanes for Sha3Neon {
+    #[inline(always)]
+    unsafe fn zero() -> Self {
+        Sha3Neon(vdupq_n_u64(0))
+    }
+
+    #[inline(always)]
+    unsafe fn splat(x: u64) -> Self {
+        Sha3Neon(vdupq_n_u64(x))
+    }
+
+    #[inline(always)]
+    unsafe fn load(p: *const u64) -> Self {
+        Sha3Neon(vld1q_u64(p))
+    }
+
+    #[inline(always)]
+    unsafe fn store(self, p: *mut u64) {
+        vst1q_u64(p, self.0)
+    }
+
+    #[inline(always)]
+    unsafe fn xor(a: Self, b: Self) -> Self {
+        Sha3Neon(veorq_u64(a.0, b.0))
+    }
+
+    #[inline(always)]
+    unsafe fn rol<const L: i32, const R: i32>(a: Self) -> Self {
+        // XAR rotates right: rol(a, L) == ror(a ^ 0, 64 - L)
+        Sha3Neon(vxarq_u64::<R>(a.0, vdupq_n_u64(0)))
+    }
+
+    #[inline(always)]
+    unsafe fn chi(a: Self, b: Self, c: Self) -> Self {
+        // BCAX computes a ^ (c & !b) with its operands as (a, c, b)
+        Sha3Neon(vbcaxq_u64(a.0, c.0, b.0))
+    }
+
+    #[inline(always)]
+    unsafe fn xor5(a: Self, b: Self, c: Self, d: Self, e: Self) -> Self {
+        Sha3Neon(veor3q_u64(veor3q_u64(a.0, b.0, c.0), d.0, e.0))
+    }
+
+    #[inline(always)]
+    unsafe fn rax1(a: Self, b: Self) -> Self {
+        Sha3Neon(vrax1q_u64(a.0, b.0))
+    }
+
+    #[inline(always)]
+    unsafe fn xor_rol<const L: i32, const R: i32>(a: Self, d: Self) -> Self {
+        Sha3Neon(vxarq_u64::<R>(a.0, d.0))
+    }
+}
+
+#[target_feature(enable = "sha3")]
+unsafe fn sha3_256_x2_sha3(out: &[*mut u8; 2], input: &[*const u8; 2], len: &[usize; 2]) {
+    sha3_256_lanes::<Sha3Neon, 2>(out, input, len)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_x2(out: *const *mut u8, input: *const *const u8, len: *const usize) {
+    let out = &*(out as *const [*mut u8; 2]);
+    let input = &*(input as *const [*const u8; 2]);
+    let len = &*(len as *const [usize; 2]);
+
+    if std::arch::is_aarch64_feature_detected!("sha3") {
+        sha3_256_x2_sha3(out, input, len);
+    } else {
+        sha3_256_scalar(out, input, len);
+    }
+}
+
+#[target_feature(enable = "sha3")]
+unsafe fn sha3_256_sha3(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Sha3Neon, 2>(out, input, len, 0x06, 32)
+}
+
+/// SHA3-256 of every message, 2 per permutation (nano_sha3_256_batch)
+pub unsafe fn sha3_256_many(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    if std::arch::is_aarch64_feature_detected!("sha3") {
+        sha3_256_sha3(out, input, len);
+    } else {
+        sha3_256_scalar(out, input, len);
+    }
+}
+
+#[target_feature(enable = "sha3")]
+unsafe fn shake256_512_sha3(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Sha3Neon, 2>(out, input, len, 0x1F, 64)
+}
+
+/// SHAKE256 with 512-bit output for every message (ParallelHash256 leaves)
+pub unsafe fn shake256_512_many(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    if std::arch::is_aarch64_feature_detected!("sha3") {
+        shake256_512_sha3(out, input, len);
+    } else {
+        keccak_batches::<Word, 1>(out, input, len, 0x1F, 64);
+    }
+}
+
+#[target_feature(enable = "sha3")]
+unsafe fn xof_absorb_sha3<const R: usize>(xof: &mut XofX4, input: &[*const u8; 4], len: usize) {
+    xof_absorb_x4::<Sha3Neon, 2, R>(xof, input, len)
+}
+
+#[target_feature(enable = "sha3")]
+unsafe fn xof_squeeze_sha3<const R: usize>(xof: &mut XofX4, out: &[*mut u8; 4], blocks: usize) {
+    xof_squeeze_x4::<Sha3Neon, 2, R>(xof, out, blocks)
+}
+
+/// 4-way SHAKE absorb-once at rate R, two states per permutation
+pub unsafe fn xof_absorb_many<const R: usize>(xof: &mut XofX4, input: &[*const u8; 4], len: usize) {
+    if std::arch::is_aarch64_feature_detected!("sha3") {
+        xof_absorb_sha3::<R>(xof, input, len);
+    } else {
+        xof_absorb_x4::<Word, 1, R>(xof, input, len);
+    }
+}
+
+/// 4-way SHAKE squeeze of whole rate blocks, two states per permutation
+pub unsafe fn xof_squeeze_many<const R: usize>(xof: &mut XofX4, out: &[*mut u8; 4], blocks: usize) {
+    if std::arch::is_aarch64_feature_detected!("sha3") {
+        xof_squeeze_sha3::<R>(xof, out, blocks);
+    } else {
+        xof_squeeze_x4::<Word, 1, R>(xof, out, blocks);
+    }
+}
+
+#[target_feature(enable = "sha3")]
+unsafe fn node64_sha3(out: *mut u8, input: *const u8, count: usize) {
+    node64_level::<Sha3Neon, 2>(out, input, count)
+}
+
+/// One Merkle level of 64-byte nodes (nano_sha3_256_node64_many)
+pub unsafe fn node64_many(out: *mut u8, input: *const u8, count: usize) {
+    if std::arch::is_aarch64_feature_detected!("sha3") {
+        node64_sha3(out, input, count);
+    } else {
+        node64_level::<Word, 1>(out, input, count);
+    }
+}
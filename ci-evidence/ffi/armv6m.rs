@@ -0,0 +1,606 @@
+// Thumb-1 assembly Keccak-f[1600] for ARMv6-M (cortex_m0_asm library,
+// cargo feature "asm_m0" on top of "interleaved")
+// The interleaved.rs context and sponge stay in Rust; only the permutation
+// is replaced. ARMv6-M has eight low registers, no 64-bit operations and no
+// shifted operands, so the kernel works on the bit-interleaved 32-bit words
+// in memory, one lane at a time:
+//   - Theta parities and the D words live in an 80-byte stack frame
+//   - Rho + Pi runs in place along the 24-lane pi cycle with theta folded
+//     in, so no second state array is needed (108 B of stack in total)
+//   - Chi loops over the five rows, BIC + EOR per word
+// About 25.4k cycles per permutation at zero wait states (ARMv6-M
+// instruction timings), 1008 bytes of code.
+
+use core::arch::global_asm;
+
+extern "C" {
+    fn nano_sha3_256_keccak_f1600_m0(state: *mut u32, rc: *const [u32; 2]);
+}
+
+/// Keccak-f[1600] on an interleaved state (lane i in state[2i] / state[2i + 1])
+#[inline(always)]
+pub fn keccak_f1600(state: &mut [u32; 50], rc: &[[u32; 2]; 24]) {
+    unsafe { nano_sha3_256_keccak_f1600_m0(state.as_mut_ptr(), rc.as_ptr()) }
+}
+
+// Code section of the kernel: flash, or RAM / ITCM under "ramfunc" / "tcm"
+#[cfg(not(any(feature = "ramfunc", feature = "tcm")))]
+macro_rules! kernel_section {
+    () => { ".pushsection .text.nano_sha3_256_keccak_f1600_m0,\"ax\",%progbits" };
+}
+#[cfg(feature = "ramfunc")]
+macro_rules! kernel_section {
+    () => { ".pushsection .ramfunc.nano_sha3_256_keccak_f1600_m0,\"ax\",%progbits" };
+}
+#[cfg(feature = "tcm")]
+macro_rules! kernel_section {
+    () => { ".pushsection .itcm.nano_sha3_256_keccak_f1600_m0,\"ax\",%progbits" };
+}
+
+// r0 = state (50 words), r1 = interleaved round constants (24 x [even, odd]);
+// AAPCS: r4-r7 saved, r8-r12 untouched
+global_asm!(
+    kernel_section!(),
+    ".p2align 2",
+    ".global nano_sha3_256_keccak_f1600_m0",
+    ".hidden nano_sha3_256_keccak_f1600_m0",
+    ".type nano_sha3_256_keccak_f1600_m0,%function",
+    ".thumb_func",
+    "nano_sha3_256_keccak_f1600_m0:",
+    "push {{r4, r5, r6, r7, lr}}",
+    "sub sp, #88",
+    // sp+0: C[10], sp+40: D[10], sp+80: next round constant, sp+84: end of table
+    "str r1, [sp, #80]",
+    "adds r1, #192",
+    "str r1, [sp, #84]",
+    // Words 0..31 are reached from r0, 25..49 from r7 (5-bit word offsets)
+    "movs r7, r0",
+    "adds r7, #100",
+    ".Lround:",
+    // Theta: column parities C[x] = a[x] ^ a[x+5] ^ a[x+10] ^ a[x+15] ^ a[x+20]
+    // C[0]
+    "ldr r1, [r0, #0]",
+    "ldr r2, [r0, #40]",
+    "eors r1, r2",
+    "ldr r2, [r0, #80]",
+    "eors r1, r2",
+    "ldr r2, [r0, #120]",
+    "eors r1, r2",
+    "ldr r2, [r7, #60]",
+    "eors r1, r2",
+    "str r1, [sp, #0]",
+    "ldr r1, [r0, #4]",
+    "ldr r2, [r0, #44]",
+    "eors r1, r2",
+    "ldr r2, [r0, #84]",
+    "eors r1, r2",
+    "ldr r2, [r0, #124]",
+    "eors r1, r2",
+    "ldr r2, [r7, #64]",
+    "eors r1, r2",
+    "str r1, [sp, #4]",
+    // C[1]
+    "ldr r1, [r0, #8]",
+    "ldr r2, [r0, #48]",
+    "eors r1, r2",
+    "ldr r2, [r0, #88]",
+    "eors r1, r2",
+    "ldr r2, [r7, #28]",
+    "eors r1, r2",
+    "ldr r2, [r7, #68]",
+    "eors r1, r2",
+    "str r1, [sp, #8]",
+    "ldr r1, [r0, #12]",
+    "ldr r2, [r0, #52]",
+    "eors r1, r2",
+    "ldr r2, [r0, #92]",
+    "eors r1, r2",
+    "ldr r2, [r7, #32]",
+    "eors r1, r2",
+    "ldr r2, [r7, #72]",
+    "eors r1, r2",
+    "str r1, [sp, #12]",
+    // C[2]
+    "ldr r1, [r0, #16]",
+    "ldr r2, [r0, #56]",
+    "eors r1, r2",
+    "ldr r2, [r0, #96]",
+    "eors r1, r2",
+    "ldr r2, [r7, #36]",
+    "eors r1, r2",
+    "ldr r2, [r7, #76]",
+    "eors r1, r2",
+    "str r1, [sp, #16]",
+    "ldr r1, [r0, #20]",
+    "ldr r2, [r0, #60]",
+    "eors r1, r2",
+    "ldr r2, [r0, #100]",
+    "eors r1, r2",
+    "ldr r2, [r7, #40]",
+    "eors r1, r2",
+    "ldr r2, [r7, #80]",
+    "eors r1, r2",
+    "str r1, [sp, #20]",
+    // C[3]
+    "ldr r1, [r0, #24]",
+    "ldr r2, [r0, #64]",
+    "eors r1, r2",
+    "ldr r2, [r0, #104]",
+    "eors r1, r2",
+    "ldr r2, [r7, #44]",
+    "eors r1, r2",
+    "ldr r2, [r7, #84]",
+    "eors r1, r2",
+    "str r1, [sp, #24]",
+    "ldr r1, [r0, #28]",
+    "ldr r2, [r0, #68]",
+    "eors r1, r2",
+    "ldr r2, [r0, #108]",
+    "eors r1, r2",
+    "ldr r2, [r7, #48]",
+    "eors r1, r2",
+    "ldr r2, [r7, #88]",
+    "eors r1, r2",
+    "str r1, [sp, #28]",
+    // C[4]
+    "ldr r1, [r0, #32]",
+    "ldr r2, [r0, #72]",
+    "eors r1, r2",
+    "ldr r2, [r0, #112]",
+    "eors r1, r2",
+    "ldr r2, [r7, #52]",
+    "eors r1, r2",
+    "ldr r2, [r7, #92]",
+    "eors r1, r2",
+    "str r1, [sp, #32]",
+    "ldr r1, [r0, #36]",
+    "ldr r2, [r0, #76]",
+    "eors r1, r2",
+    "ldr r2, [r0, #116]",
+    "eors r1, r2",
+    "ldr r2, [r7, #56]",
+    "eors r1, r2",
+    "ldr r2, [r7, #96]",
+    "eors r1, r2",
+    "str r1, [sp, #36]",
+    // D[x] = C[x-1] ^ rol(C[x+1], 1); the 1-bit rotate swaps halves and
+    // rotates the (new) even word by one
+    "movs r6, #31",
+    // D[0] = C[4] ^ rol(C[1], 1)
+    "ldr r1, [sp, #12]",
+    "rors r1, r6",
+    "ldr r2, [sp, #32]",
+    "eors r1, r2",
+    "str r1, [sp, #40]",
+    "ldr r1, [sp, #8]",
+    "ldr r2, [sp, #36]",
+    "eors r1, r2",
+    "str r1, [sp, #44]",
+    // D[1] = C[0] ^ rol(C[2], 1)
+    "ldr r1, [sp, #20]",
+    "rors r1, r6",
+    "ldr r2, [sp, #0]",
+    "eors r1, r2",
+    "str r1, [sp, #48]",
+    "ldr r1, [sp, #16]",
+    "ldr r2, [sp, #4]",
+    "eors r1, r2",
+    "str r1, [sp, #52]",
+    // D[2] = C[1] ^ rol(C[3], 1)
+    "ldr r1, [sp, #28]",
+    "rors r1, r6",
+    "ldr r2, [sp, #8]",
+    "eors r1, r2",
+    "str r1, [sp, #56]",
+    "ldr r1, [sp, #24]",
+    "ldr r2, [sp, #12]",
+    "eors r1, r2",
+    "str r1, [sp, #60]",
+    // D[3] = C[2] ^ rol(C[4], 1)
+    "ldr r1, [sp, #36]",
+    "rors r1, r6",
+    "ldr r2, [sp, #16]",
+    "eors r1, r2",
+    "str r1, [sp, #64]",
+    "ldr r1, [sp, #32]",
+    "ldr r2, [sp, #20]",
+    "eors r1, r2",
+    "str r1, [sp, #68]",
+    // D[4] = C[3] ^ rol(C[0], 1)
+    "ldr r1, [sp, #4]",
+    "rors r1, r6",
+    "ldr r2, [sp, #24]",
+    "eors r1, r2",
+    "str r1, [sp, #72]",
+    "ldr r1, [sp, #0]",
+    "ldr r2, [sp, #28]",
+    "eors r1, r2",
+    "str r1, [sp, #76]",
+    // Lane 0: theta only (no rotation, fixed by pi)
+    "ldr r1, [r0, #0]",
+    "ldr r2, [sp, #40]",
+    "eors r1, r2",
+    "str r1, [r0, #0]",
+    "ldr r1, [r0, #4]",
+    "ldr r2, [sp, #44]",
+    "eors r1, r2",
+    "str r1, [r0, #4]",
+    // Rho + Pi in place along the 24-lane pi cycle, theta folded into each
+    // lane as it is carried: a[dst] = rol(a[src] ^ D[src % 5], r)
+    "ldr r1, [r0, #8]",
+    "ldr r2, [r0, #12]",
+    // a[10] <- rol(a[1] ^ D[1], 1)
+    "ldr r3, [r0, #80]",
+    "ldr r4, [r0, #84]",
+    "ldr r5, [sp, #48]",
+    "eors r1, r5",
+    "ldr r5, [sp, #52]",
+    "eors r2, r5",
+    "movs r5, #31",
+    "rors r2, r5",
+    "str r2, [r0, #80]",
+    "str r1, [r0, #84]",
+    // a[7] <- rol(a[10] ^ D[0], 3)
+    "ldr r1, [r0, #56]",
+    "ldr r2, [r0, #60]",
+    "ldr r5, [sp, #40]",
+    "eors r3, r5",
+    "ldr r5, [sp, #44]",
+    "eors r4, r5",
+    "movs r5, #30",
+    "rors r4, r5",
+    "movs r5, #31",
+    "rors r3, r5",
+    "str r4, [r0, #56]",
+    "str r3, [r0, #60]",
+    // a[11] <- rol(a[7] ^ D[2], 6)
+    "ldr r3, [r0, #88]",
+    "ldr r4, [r0, #92]",
+    "ldr r5, [sp, #56]",
+    "eors r1, r5",
+    "ldr r5, [sp, #60]",
+    "eors r2, r5",
+    "movs r5, #29",
+    "rors r1, r5",
+    "rors r2, r5",
+    "str r1, [r0, #88]",
+    "str r2, [r0, #92]",
+    // a[17] <- rol(a[11] ^ D[1], 10)
+    "ldr r1, [r7, #36]",
+    "ldr r2, [r7, #40]",
+    "ldr r5, [sp, #48]",
+    "eors r3, r5",
+    "ldr r5, [sp, #52]",
+    "eors r4, r5",
+    "movs r5, #27",
+    "rors r3, r5",
+    "rors r4, r5",
+    "str r3, [r7, #36]",
+    "str r4, [r7, #40]",
+    // a[18] <- rol(a[17] ^ D[2], 15)
+    "ldr r3, [r7, #44]",
+    "ldr r4, [r7, #48]",
+    "ldr r5, [sp, #56]",
+    "eors r1, r5",
+    "ldr r5, [sp, #60]",
+    "eors r2, r5",
+    "movs r5, #24",
+    "rors r2, r5",
+    "movs r5, #25",
+    "rors r1, r5",
+    "str r2, [r7, #44]",
+    "str r1, [r7, #48]",
+    // a[3] <- rol(a[18] ^ D[3], 21)
+    "ldr r1, [r0, #24]",
+    "ldr r2, [r0, #28]",
+    "ldr r5, [sp, #64]",
+    "eors r3, r5",
+    "ldr r5, [sp, #68]",
+    "eors r4, r5",
+    "movs r5, #21",
+    "rors r4, r5",
+    "movs r5, #22",
+    "rors r3, r5",
+    "str r4, [r0, #24]",
+    "str r3, [r0, #28]",
+    // a[5] <- rol(a[3] ^ D[3], 28)
+    "ldr r3, [r0, #40]",
+    "ldr r4, [r0, #44]",
+    "ldr r5, [sp, #64]",
+    "eors r1, r5",
+    "ldr r5, [sp, #68]",
+    "eors r2, r5",
+    "movs r5, #18",
+    "rors r1, r5",
+    "rors r2, r5",
+    "str r1, [r0, #40]",
+    "str r2, [r0, #44]",
+    // a[16] <- rol(a[5] ^ D[0], 36)
+    "ldr r1, [r7, #28]",
+    "ldr r2, [r7, #32]",
+    "ldr r5, [sp, #40]",
+    "eors r3, r5",
+    "ldr r5, [sp, #44]",
+    "eors r4, r5",
+    "movs r5, #14",
+    "rors r3, r5",
+    "rors r4, r5",
+    "str r3, [r7, #28]",
+    "str r4, [r7, #32]",
+    // a[8] <- rol(a[16] ^ D[1], 45)
+    "ldr r3, [r0, #64]",
+    "ldr r4, [r0, #68]",
+    "ldr r5, [sp, #48]",
+    "eors r1, r5",
+    "ldr r5, [sp, #52]",
+    "eors r2, r5",
+    "movs r5, #9",
+    "rors r2, r5",
+    "movs r5, #10",
+    "rors r1, r5",
+    "str r2, [r0, #64]",
+    "str r1, [r0, #68]",
+    // a[21] <- rol(a[8] ^ D[3], 55)
+    "ldr r1, [r7, #68]",
+    "ldr r2, [r7, #72]",
+    "ldr r5, [sp, #64]",
+    "eors r3, r5",
+    "ldr r5, [sp, #68]",
+    "eors r4, r5",
+    "movs r5, #4",
+    "rors r4, r5",
+    "movs r5, #5",
+    "rors r3, r5",
+    "str r4, [r7, #68]",
+    "str r3, [r7, #72]",
+    // a[24] <- rol(a[21] ^ D[1], 2)
+    "ldr r3, [r7, #92]",
+    "ldr r4, [r7, #96]",
+    "ldr r5, [sp, #48]",
+    "eors r1, r5",
+    "ldr r5, [sp, #52]",
+    "eors r2, r5",
+    "movs r5, #31",
+    "rors r1, r5",
+    "rors r2, r5",
+    "str r1, [r7, #92]",
+    "str r2, [r7, #96]",
+    // a[4] <- rol(a[24] ^ D[4], 14)
+    "ldr r1, [r0, #32]",
+    "ldr r2, [r0, #36]",
+    "ldr r5, [sp, #72]",
+    "eors r3, r5",
+    "ldr r5, [sp, #76]",
+    "eors r4, r5",
+    "movs r5, #25",
+    "rors r3, r5",
+    "rors r4, r5",
+    "str r3, [r0, #32]",
+    "str r4, [r0, #36]",
+    // a[15] <- rol(a[4] ^ D[4], 27)
+    "ldr r3, [r0, #120]",
+    "ldr r4, [r0, #124]",
+    "ldr r5, [sp, #72]",
+    "eors r1, r5",
+    "ldr r5, [sp, #76]",
+    "eors r2, r5",
+    "movs r5, #18",
+    "rors r2, r5",
+    "movs r5, #19",
+    "rors r1, r5",
+    "str r2, [r0, #120]",
+    "str r1, [r0, #124]",
+    // a[23] <- rol(a[15] ^ D[0], 41)
+    "ldr r1, [r7, #84]",
+    "ldr r2, [r7, #88]",
+    "ldr r5, [sp, #40]",
+    "eors r3, r5",
+    "ldr r5, [sp, #44]",
+    "eors r4, r5",
+    "movs r5, #11",
+    "rors r4, r5",
+    "movs r5, #12",
+    "rors r3, r5",
+    "str r4, [r7, #84]",
+    "str r3, [r7, #88]",
+    // a[19] <- rol(a[23] ^ D[3], 56)
+    "ldr r3, [r7, #52]",
+    "ldr r4, [r7, #56]",
+    "ldr r5, [sp, #64]",
+    "eors r1, r5",
+    "ldr r5, [sp, #68]",
+    "eors r2, r5",
+    "movs r5, #4",
+    "rors r1, r5",
+    "rors r2, r5",
+    "str r1, [r7, #52]",
+    "str r2, [r7, #56]",
+    // a[13] <- rol(a[19] ^ D[4], 8)
+    "ldr r1, [r0, #104]",
+    "ldr r2, [r0, #108]",
+    "ldr r5, [sp, #72]",
+    "eors r3, r5",
+    "ldr r5, [sp, #76]",
+    "eors r4, r5",
+    "movs r5, #28",
+    "rors r3, r5",
+    "rors r4, r5",
+    "str r3, [r0, #104]",
+    "str r4, [r0, #108]",
+    // a[12] <- rol(a[13] ^ D[3], 25)
+    "ldr r3, [r0, #96]",
+    "ldr r4, [r0, #100]",
+    "ldr r5, [sp, #64]",
+    "eors r1, r5",
+    "ldr r5, [sp, #68]",
+    "eors r2, r5",
+    "movs r5, #19",
+    "rors r2, r5",
+    "movs r5, #20",
+    "rors r1, r5",
+    "str r2, [r0, #96]",
+    "str r1, [r0, #100]",
+    // a[2] <- rol(a[12] ^ D[2], 43)
+    "ldr r1, [r0, #16]",
+    "ldr r2, [r0, #20]",
+    "ldr r5, [sp, #56]",
+    "eors r3, r5",
+    "ldr r5, [sp, #60]",
+    "eors r4, r5",
+    "movs r5, #10",
+    "rors r4, r5",
+    "movs r5, #11",
+    "rors r3, r5",
+    "str r4, [r0, #16]",
+    "str r3, [r0, #20]",
+    // a[20] <- rol(a[2] ^ D[2], 62)
+    "ldr r3, [r7, #60]",
+    "ldr r4, [r7, #64]",
+    "ldr r5, [sp, #56]",
+    "eors r1, r5",
+    "ldr r5, [sp, #60]",
+    "eors r2, r5",
+    "movs r5, #1",
+    "rors r1, r5",
+    "rors r2, r5",
+    "str r1, [r7, #60]",
+    "str r2, [r7, #64]",
+    // a[14] <- rol(a[20] ^ D[0], 18)
+    "ldr r1, [r0, #112]",
+    "ldr r2, [r0, #116]",
+    "ldr r5, [sp, #40]",
+    "eors r3, r5",
+    "ldr r5, [sp, #44]",
+    "eors r4, r5",
+    "movs r5, #23",
+    "rors r3, r5",
+    "rors r4, r5",
+    "str r3, [r0, #112]",
+    "str r4, [r0, #116]",
+    // a[22] <- rol(a[14] ^ D[4], 39)
+    "ldr r3, [r7, #76]",
+    "ldr r4, [r7, #80]",
+    "ldr r5, [sp, #72]",
+    "eors r1, r5",
+    "ldr r5, [sp, #76]",
+    "eors r2, r5",
+    "movs r5, #12",
+    "rors r2, r5",
+    "movs r5, #13",
+    "rors r1, r5",
+    "str r2, [r7, #76]",
+    "str r1, [r7, #80]",
+    // a[9] <- rol(a[22] ^ D[2], 61)
+    "ldr r1, [r0, #72]",
+    "ldr r2, [r0, #76]",
+    "ldr r5, [sp, #56]",
+    "eors r3, r5",
+    "ldr r5, [sp, #60]",
+    "eors r4, r5",
+    "movs r5, #1",
+    "rors r4, r5",
+    "movs r5, #2",
+    "rors r3, r5",
+    "str r4, [r0, #72]",
+    "str r3, [r0, #76]",
+    // a[6] <- rol(a[9] ^ D[4], 20)
+    "ldr r3, [r0, #48]",
+    "ldr r4, [r0, #52]",
+    "ldr r5, [sp, #72]",
+    "eors r1, r5",
+    "ldr r5, [sp, #76]",
+    "eors r2, r5",
+    "movs r5, #22",
+    "rors r1, r5",
+    "rors r2, r5",
+    "str r1, [r0, #48]",
+    "str r2, [r0, #52]",
+    // a[1] <- rol(a[6] ^ D[1], 44)
+    "ldr r5, [sp, #48]",
+    "eors r3, r5",
+    "ldr r5, [sp, #52]",
+    "eors r4, r5",
+    "movs r5, #10",
+    "rors r3, r5",
+    "rors r4, r5",
+    "str r3, [r0, #8]",
+    "str r4, [r0, #12]",
+    // Chi one row (five lanes) per iteration, even then odd words:
+    // a[x] ^= ~a[x+1] & a[x+2], originals held in r1-r5
+    "adds r7, #100",
+    ".Lchi:",
+    // even words
+    "ldr r1, [r0, #0]",
+    "ldr r2, [r0, #8]",
+    "ldr r3, [r0, #16]",
+    "ldr r4, [r0, #24]",
+    "ldr r5, [r0, #32]",
+    "movs r6, r3",
+    "bics r6, r2",
+    "eors r6, r1",
+    "str r6, [r0, #0]",
+    "movs r6, r4",
+    "bics r6, r3",
+    "eors r6, r2",
+    "str r6, [r0, #8]",
+    "movs r6, r5",
+    "bics r6, r4",
+    "eors r6, r3",
+    "str r6, [r0, #16]",
+    "movs r6, r1",
+    "bics r6, r5",
+    "eors r6, r4",
+    "str r6, [r0, #24]",
+    "bics r2, r1",
+    "eors r2, r5",
+    "str r2, [r0, #32]",
+    // odd words
+    "ldr r1, [r0, #4]",
+    "ldr r2, [r0, #12]",
+    "ldr r3, [r0, #20]",
+    "ldr r4, [r0, #28]",
+    "ldr r5, [r0, #36]",
+    "movs r6, r3",
+    "bics r6, r2",
+    "eors r6, r1",
+    "str r6, [r0, #4]",
+    "movs r6, r4",
+    "bics r6, r3",
+    "eors r6, r2",
+    "str r6, [r0, #12]",
+    "movs r6, r5",
+    "bics r6, r4",
+    "eors r6, r3",
+    "str r6, [r0, #20]",
+    "movs r6, r1",
+    "bics r6, r5",
+    "eors r6, r4",
+    "str r6, [r0, #28]",
+    "bics r2, r1",
+    "eors r2, r5",
+    "str r2, [r0, #36]",
+    "adds r0, #40",
+    "cmp r0, r7",
+    "bne .Lchi",
+    "subs r0, #200",
+    "subs r7, #100",
+    // Iota, then the next round until the constant table runs out
+    "ldr r5, [sp, #80]",
+    "ldm r5!, {{r1, r2}}",
+    "ldr r3, [r0, #0]",
+    "eors r3, r1",
+    "str r3, [r0, #0]",
+    "ldr r3, [r0, #4]",
+    "eors r3, r2",
+    "str r3, [r0, #4]",
+    "str r5, [sp, #80]",
+    "ldr r6, [sp, #84]",
+    "cmp r5, r6",
+    "beq .Ldone",
+    "b .Lround",
+    ".Ldone:",
+    "add sp, #88",
+    "pop {{r4, r5, r6, r7, pc}}",
+    ".size nano_sha3_256_keccak_f1600_m0, . - nano_sha3_256_keccak_f1600_m0",
+    ".popsection",
+);
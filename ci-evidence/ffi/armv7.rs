@@ -0,0 +1,141 @@
+// armv7 Linux multi-buffer kernel (arm_linux library)
+// nano_sha3_256_x2: 2 states in 128-bit NEON q registers, so each 64-bit
+// rotate is a VSHL + VSRI pair instead of a 32-bit GPR sequence.
+// CPUs without NEON fall back to the scalar core.
+
+use core::arch::arm::*;
+
+use super::keccak::{Lanes, Word};
+use super::multibuf::{
+    keccak_batches, node64_level, sha3_256_lanes, sha3_256_scalar, xof_absorb_x4, xof_squeeze_x4, XofX4,
+};
+
+#[derive(Clone, Copy)]
+struct Neon(uint64x2_t);
+
+impl Lanes for Neon {
+    #[inline(always)]
+    unsafe fn zero() -> Self {
+        Neon(vdupq_n_u64(0))
+    }
+
+    #[inline(always)]
+    unsafe fn splat(x: u64) -> Self {
+        Neon(vdupq_n_u64(x))
+    }
+
+    #[inline(always)]
+    unsafe fn load(p: *const u64) -> Self {
+        Neon(vld1q_u64(p))
+    }
+
+    #[inline(always)]
+    unsafe fn store(self, p: *mut u64) {
+        vst1q_u64(p, self.0)
+    }
+
+    #[inline(always)]
+    unsafe fn xor(a: Self, b: Self) -> Self {
+        Neon(veorq_u64(a.0, b.0))
+    }
+
+    #[inline(always)]
+    unsafe fn rol<const L: i32, const R: i32>(a: Self) -> Self {
+        // Shift left, then insert the bits shifted out from the right
+        Neon(vsriq_n_u64::<R>(vshlq_n_u64::<L>(a.0), a.0))
+    }
+
+    #[inline(always)]
+    unsafe fn chi(a: Self, b: Self, c: Self) -> Self {
+        // VBIC computes c & !b
+        Neon(veorq_u64(a.0, vbicq_u64(c.0, b.0)))
+    }
+}
+
+#[target_feature(enable = "neon")]
+unsafe fn sha3_256_x2_neon(out: &[*mut u8; 2], input: &[*const u8; 2], len: &[usize; 2]) {
+    sha3_256_lanes::<Neon, 2>(out, input, len)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_x2(out: *const *mut u8, input: *const *const u8, len: *const usize) {
+    let out = &*(out as *const [*mut u8; 2]);
+    let input = &*(input as *const [*const u8; 2]);
+    let len = &*(len as *const [usize; 2]);
+
+    if std::arch::is_arm_feature_detected!("neon") {
+        sha3_256_x2_neon(out, input, len);
+    } else {
+        sha3_256_scalar(out, input, len);
+    }
+}
+
+#[target_feature(enable = "neon")]
+unsafe fn sha3_256_neon(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Neon, 2>(out, input, len, 0x06, 32)
+}
+
+/// SHA3-256 of every message, 2 per permutation (nano_sha3_256_batch)
+pub unsafe fn sha3_256_many(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    if std::arch::is_arm_feature_detected!("neon") {
+        sha3_256_neon(out, input, len);
+    } else {
+        sha3_256_scalar(out, input, len);
+    }
+}
+
+#[target_feature(enable = "neon")]
+unsafe fn shake256_512_neon(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Neon, 2>(out, input, len, 0x1F, 64)
+}
+
+/// SHAKE256 with 512-bit output for every message (ParallelHash256 leaves)
+pub unsafe fn shake256_512_many(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    if std::arch::is_arm_feature_detected!("neon") {
+        shake256_512_neon(out, input, len);
+    } else {
+        keccak_batches::<Word, 1>(out, input, len, 0x1F, 64);
+    }
+}
+
+#[target_feature(enable = "neon")]
+unsafe fn xof_absorb_neon<const R: usize>(xof: &mut XofX4, input: &[*const u8; 4], len: usize) {
+    xof_absorb_x4::<Neon, 2, R>(xof, input, len)
+}
+
+#[target_feature(enable = "neon")]
+unsafe fn xof_squeeze_neon<const R: usize>(xof: &mut XofX4, out: &[*mut u8; 4], blocks: usize) {
+    xof_squeeze_x4::<Neon, 2, R>(xof, out, blocks)
+}
+
+/// 4-way SHAKE absorb-once at rate R, two states per permutation
+pub unsafe fn xof_absorb_many<const R: usize>(xof: &mut XofX4, input: &[*const u8; 4], len: usize) {
+    if std::arch::is_arm_feature_detected!("neon") {
+        xof_absorb_neon::<R>(xof, input, len);
+    } else {
+        xof_absorb_x4::<Word, 1, R>(xof, input, len);
+    }
+}
+
+/// 4-way SHAKE squeeze of whole rate blocks, two states per permutation
+pub unsafe fn xof_squeeze_many<const R: usize>(xof: &mut XofX4, out: &[*mut u8; 4], blocks: usize) {
+    if std::arch::is_arm_feature_detected!("neon") {
+        xof_squeeze_neon::<R>(xof, out, blocks);
+    } else {
+        xof_squeeze_x4::<Word, 1, R>(xof, out, blocks);
+    }
+}
+
+#[target_feature(enable = "neon")]
+unsafe fn node64_neon(out: *mut u8, input: *const u8, count: usize) {
+    node64_level::<Neon, 2>(out, input, count)
+}
+
+/// One Merkle level of 64-byte nodes (nano_sha3_256_node64_many)
+pub unsafe fn node64_many(out: *mut u8, input: *const u8, count: usize) {
+    if std::arch::is_arm_feature_detected!("neon") {
+        node64_neon(out, input, count);
+    } else {
+        node64_level::<Word, 1>(out, input, count);
+    }
+}
@@ -0,0 +1,153 @@
+// Batch SHA3-256 of many independent messages for the Linux libraries
+// Jobs are cut into runs of RUN_JOBS. Each worker owns a contiguous range
+// of runs and takes them from its front; a worker whose range is empty
+// steals runs from the back of the others', so a few very long messages
+// never leave the rest of the cores idle. Within a run the jobs are put in
+// length order (an index array on the worker's stack) and hashed N at a
+// time on the multi-buffer kernel, so the lanes of one permutation call
+// hold messages of similar length. Digests go straight to each job's
+// output slot; apart from spawning the worker threads nothing is allocated.
+
+use core::cmp::min;
+use core::ptr;
+use core::slice;
+use core::sync::atomic::{AtomicU64, Ordering};
+use std::thread;
+
+#[cfg(target_arch = "x86_64")]
+use super::x86::sha3_256_many;
+#[cfg(target_arch = "aarch64")]
+use super::aarch64::sha3_256_many;
+#[cfg(all(target_arch = "arm", target_os = "linux"))]
+use super::armv7::sha3_256_many;
+
+/// One message of a batch (nano_sha3_256_job in C)
+#[repr(C)]
+pub struct NanoSha3_256Job {
+    input: *const u8,
+    len: usize,
+    out: *mut u8,
+}
+
+/// Jobs per unit of work: enough to sort into full lanes, small enough to steal
+const RUN_JOBS: usize = 64;
+
+/// Most worker threads per call (their ranges live on the caller's stack)
+const MAX_THREADS: usize = 256;
+
+/// A worker's runs not taken yet: front in the low half, end in the high half
+struct Runs(AtomicU64);
+
+impl Runs {
+    const EMPTY: Runs = Runs(AtomicU64::new(0));
+
+    fn set(&self, front: usize, end: usize) {
+        self.0.store((end as u64) << 32 | front as u64, Ordering::Relaxed);
+    }
+
+    /// Next run for the owner (`steal` false) or a thief (`steal` true)
+    fn take(&self, steal: bool) -> Option<usize> {
+        let mut cur = self.0.load(Ordering::Acquire);
+        loop {
+            let (front, end) = (cur as u32 as u64, cur >> 32);
+            if front >= end {
+                return None;
+            }
+            let (run, next) = if steal {
+                (end - 1, (end - 1) << 32 | front)
+            } else {
+                (front, end << 32 | (front + 1))
+            };
+            match self.0.compare_exchange_weak(cur, next, Ordering::AcqRel, Ordering::Acquire) {
+                Ok(_) => return Some(run as usize),
+                Err(seen) => cur = seen,
+            }
+        }
+    }
+}
+
+/// Hash run `run` of the batch, shortest message first
+unsafe fn hash_run(jobs: &[NanoSha3_256Job], run: usize) {
+    let first = run * RUN_JOBS;
+    let run = &jobs[first..min(first + RUN_JOBS, jobs.len())];
+    let n = run.len();
+
+    let mut order = [0u8; RUN_JOBS];
+    for (k, slot) in order[..n].iter_mut().enumerate() {
+        *slot = k as u8;
+    }
+    order[..n].sort_unstable_by_key(|&k| run[k as usize].len);
+
+    let mut o = [ptr::null_mut(); RUN_JOBS];
+    let mut i = [ptr::null(); RUN_JOBS];
+    let mut l = [0usize; RUN_JOBS];
+    for (k, &j) in order[..n].iter().enumerate() {
+        let job = &run[j as usize];
+        o[k] = job.out;
+        i[k] = job.input;
+        l[k] = job.len;
+    }
+    sha3_256_many(&o[..n], &i[..n], &l[..n]);
+}
+
+/// Worker `me`: its own runs front to back, then the others' back to front
+/// No run is ever added, so once every range is empty the batch is done.
+unsafe fn worker(jobs: &[NanoSha3_256Job], ranges: &[Runs], me: usize) {
+    while let Some(run) = ranges[me].take(false) {
+        hash_run(jobs, run);
+    }
+    for k in 1..ranges.len() {
+        let victim = &ranges[(me + k) % ranges.len()];
+        while let Some(run) = victim.take(true) {
+            hash_run(jobs, run);
+        }
+    }
+}
+
+/// Hash every job on `threads` workers (0 for one per available core)
+pub unsafe fn sha3_256_batch(jobs: &[NanoSha3_256Job], threads: usize) {
+    let runs = (jobs.len() + RUN_JOBS - 1) / RUN_JOBS;
+    let threads = match threads {
+        0 => thread::available_parallelism().map_or(1, |n| n.get()),
+        n => n,
+    };
+    let threads = min(min(threads, MAX_THREADS), runs);
+    if threads <= 1 {
+        for run in 0..runs {
+            hash_run(jobs, run);
+        }
+        return;
+    }
+
+    // Even split to start with; stealing evens out the message lengths
+    let ranges = [Runs::EMPTY; MAX_THREADS];
+    let ranges = &ranges[..threads];
+    for (t, range) in ranges.iter().enumerate() {
+        let split = |t: usize| (runs as u64 * t as u64 / threads as u64) as usize;
+        range.set(split(t), split(t + 1));
+    }
+
+    // The raw pointers in the jobs are the caller's promise, share them as usize
+    let (base, count) = (jobs.as_ptr() as usize, jobs.len());
+    thread::scope(|scope| {
+        for t in 1..threads {
+            scope.spawn(move || {
+                let jobs = slice::from_raw_parts(base as *const NanoSha3_256Job, count);
+                worker(jobs, ranges, t)
+            });
+        }
+        worker(jobs, ranges, 0);
+    });
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_batch(jobs: *const NanoSha3_256Job, n: usize, threads: usize) -> i32 {
+    if n == 0 {
+        return 0;
+    }
+    if jobs.is_null() || (n / RUN_JOBS) as u64 >= u32::MAX as u64 {
+        return -1;
+    }
+    sha3_256_batch(slice::from_raw_parts(jobs, n), threads);
+    0
+}
@@ -0,0 +1,75 @@
+// Streaming context checkpoints (nano_sha3_256_export / nano_sha3_256_import)
+// A long hash, such as a multi-megabyte OTA image, can be saved to flash
+// every N blocks and resumed after a power loss or watchdog reset instead
+// of restarting from byte zero. The checkpoint is a fixed little-endian
+// image that does not depend on the context layout of the library, so one
+// exported by any in-tree backend resumes on any other:
+//
+//   offset size
+//        0    4  magic "NS3C"
+//        4    1  format version (1)
+//        5    1  reserved, 0
+//        6    2  pending: message bytes since the last full block (0 to 135)
+//        8  200  Keccak state, 25 lanes in x + 5y order, with the pending
+//                bytes already XORed into the rate
+//      208    8  check: first 8 bytes of SHA3-256 of bytes 0 to 207
+//
+// The check catches torn or erased flash writes, not tampering: whoever can
+// write the checkpoint can forge one. Libraries that wrap the core crate
+// (opaque context) do not have these functions.
+
+use core::ptr;
+
+use super::counters;
+use super::{as_context, sha3_256, NanoSha3_256Ctx, Sha3_256Context};
+
+/// Checkpoint size in bytes (NANO_SHA3_256_EXPORT_SIZE in C)
+pub const NANO_SHA3_256_EXPORT_SIZE: usize = 216;
+
+const MAGIC: [u8; 4] = *b"NS3C";
+const VERSION: u8 = 1;
+
+/// SHA3-256 rate in bytes: pending is always below it
+const RATE: usize = 136;
+
+const STATE_AT: usize = 8;
+const CHECK_AT: usize = STATE_AT + 200;
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_export_counters")]
+pub unsafe extern "C" fn nano_sha3_256_export(ctx: *const NanoSha3_256Ctx, out: *mut u8) {
+    let (state, pending) = (*(ctx as *const Sha3_256Context)).export();
+
+    let mut image = [0u8; NANO_SHA3_256_EXPORT_SIZE];
+    image[..4].copy_from_slice(&MAGIC);
+    image[4] = VERSION;
+    image[6..8].copy_from_slice(&(pending as u16).to_le_bytes());
+    for (bytes, lane) in image[STATE_AT..CHECK_AT].chunks_exact_mut(8).zip(state.iter()) {
+        bytes.copy_from_slice(&lane.to_le_bytes());
+    }
+    let check = sha3_256(&image[..CHECK_AT]);
+    image[CHECK_AT..].copy_from_slice(&check[..8]);
+
+    ptr::copy_nonoverlapping(image.as_ptr(), out, NANO_SHA3_256_EXPORT_SIZE);
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_import_counters")]
+pub unsafe extern "C" fn nano_sha3_256_import(ctx: *mut NanoSha3_256Ctx, input: *const u8) -> i32 {
+    let image = &*(input as *const [u8; NANO_SHA3_256_EXPORT_SIZE]);
+    let pending = u16::from_le_bytes([image[6], image[7]]) as usize;
+    let check = sha3_256(&image[..CHECK_AT]);
+    if image[..4] != MAGIC || image[4] != VERSION || image[5] != 0 || pending >= RATE || check[..8] != image[CHECK_AT..] {
+        return -1;
+    }
+
+    let mut state = [0u64; 25];
+    for (lane, bytes) in state.iter_mut().zip(image[STATE_AT..CHECK_AT].chunks_exact(8)) {
+        let mut word = [0u8; 8];
+        word.copy_from_slice(bytes);
+        *lane = u64::from_le_bytes(word);
+    }
+    ptr::write(as_context(ctx), Sha3_256Context::import(&state, pending));
+    counters::resume(ctx, pending);
+    0
+}
@@ -0,0 +1,279 @@
+// Hot-path counters (cargo feature "counters", off by default)
+// What the hashing in a product really costs: Keccak-f[1600] permutations,
+// full and padded partial rate blocks, bytes absorbed and, with
+// "counter_cycles", cycles spent inside the library. Kept per streaming
+// context and library-wide. Without the feature every hook below is an
+// empty inline function and the context keeps its default size, so the
+// shipped libraries (and their size badges) are unchanged.
+//
+// The SHA3-256 permutation may live in the core crate, so the counts are
+// derived at the C API from lengths alone: with `pending` bytes buffered,
+// an update of len bytes runs (pending + len) / 136 permutations and final
+// runs one more on the padded partial block. That is exact on every
+// backend and never looks at data. SHAKE and KMAC calls are not counted.
+//
+// Cycle source: rdtsc on x86_64, DWT->CYCCNT on Cortex-M3 and up (the
+// firmware enables DWT and the counter; on Cortex-M0, which has neither,
+// cycles stay 0). Other targets also report 0.
+
+#[cfg(feature = "counters")]
+pub use enabled::*;
+#[cfg(not(feature = "counters"))]
+pub use disabled::*;
+
+/// SHA3-256 rate in bytes
+#[cfg(feature = "counters")]
+const RATE: u64 = 136;
+
+#[cfg(feature = "counters")]
+mod enabled {
+    use core::mem::size_of;
+    use core::ptr;
+    #[cfg(target_has_atomic = "64")]
+    use core::sync::atomic::AtomicU64 as AtomicCount;
+    #[cfg(not(target_has_atomic = "64"))]
+    use core::sync::atomic::AtomicU32 as AtomicCount;
+    use core::sync::atomic::Ordering;
+
+    use super::super::{NanoSha3_256Ctx, STATE_BYTES};
+    use super::RATE;
+
+    /// Counter snapshot (nano_sha3_256_counters in C)
+    #[repr(C)]
+    #[derive(Clone, Copy)]
+    pub struct NanoSha3_256Counters {
+        pub permutations: u64,
+        pub full_blocks: u64,
+        pub partial_blocks: u64,
+        pub bytes: u64,
+        pub cycles: u64,
+    }
+
+    impl NanoSha3_256Counters {
+        const ZERO: Self = NanoSha3_256Counters { permutations: 0, full_blocks: 0, partial_blocks: 0, bytes: 0, cycles: 0 };
+    }
+
+    /// Per-context record in the tail of the opaque context storage
+    #[repr(C)]
+    struct Tally {
+        counters: NanoSha3_256Counters,
+        // Bytes buffered toward the next rate block (0 to 135)
+        pending: u64,
+    }
+
+    /// Extra context storage the tally takes (NANO_SHA3_256_COUNTERS in C)
+    pub const TALLY_SIZE: usize = size_of::<Tally>();
+
+    #[inline(always)]
+    unsafe fn tally(ctx: *const NanoSha3_256Ctx) -> *mut Tally {
+        (ctx as *mut u8).add(STATE_BYTES) as *mut Tally
+    }
+
+    // Library-wide totals. Counters are 32-bit (wrapping) where the target
+    // has no 64-bit atomics; ARMv6-M has no atomic add at all, so there an
+    // update racing an interrupt handler that also hashes can lose a count.
+    const ZERO: AtomicCount = AtomicCount::new(0);
+    static GLOBAL: [AtomicCount; 5] = [ZERO; 5];
+    const PERMUTATIONS: usize = 0;
+    const FULL_BLOCKS: usize = 1;
+    const PARTIAL_BLOCKS: usize = 2;
+    const BYTES: usize = 3;
+    const CYCLES: usize = 4;
+
+    #[inline(always)]
+    fn bump(i: usize, n: u64) {
+        #[cfg(target_has_atomic = "32")]
+        GLOBAL[i].fetch_add(n as _, Ordering::Relaxed);
+        #[cfg(not(target_has_atomic = "32"))]
+        GLOBAL[i].store(GLOBAL[i].load(Ordering::Relaxed).wrapping_add(n as _), Ordering::Relaxed);
+    }
+
+    fn add(counters: &mut NanoSha3_256Counters, delta: &NanoSha3_256Counters) {
+        counters.permutations += delta.permutations;
+        counters.full_blocks += delta.full_blocks;
+        counters.partial_blocks += delta.partial_blocks;
+        counters.bytes += delta.bytes;
+        counters.cycles += delta.cycles;
+    }
+
+    fn add_global(delta: &NanoSha3_256Counters) {
+        bump(PERMUTATIONS, delta.permutations);
+        bump(FULL_BLOCKS, delta.full_blocks);
+        bump(PARTIAL_BLOCKS, delta.partial_blocks);
+        bump(BYTES, delta.bytes);
+        bump(CYCLES, delta.cycles);
+    }
+
+    /// Cycle count at the start of a counted call
+    pub type Stamp = u64;
+
+    #[cfg(all(feature = "counter_cycles", target_arch = "x86_64"))]
+    #[inline(always)]
+    pub fn start() -> Stamp {
+        unsafe { core::arch::x86_64::_rdtsc() }
+    }
+
+    #[cfg(all(feature = "counter_cycles", target_arch = "x86_64"))]
+    #[inline(always)]
+    fn elapsed(t: Stamp) -> u64 {
+        start().wrapping_sub(t)
+    }
+
+    // DWT->CYCCNT; 32 bits, so one call must stay under 2^32 cycles.
+    // Cortex-M0 (no atomic add, no DWT cycle counter) is left out.
+    #[cfg(all(feature = "counter_cycles", target_arch = "arm", target_os = "none", target_has_atomic = "32"))]
+    const DWT_CYCCNT: usize = 0xE000_1004;
+
+    #[cfg(all(feature = "counter_cycles", target_arch = "arm", target_os = "none", target_has_atomic = "32"))]
+    #[inline(always)]
+    pub fn start() -> Stamp {
+        unsafe { ptr::read_volatile(DWT_CYCCNT as *const u32) as u64 }
+    }
+
+    #[cfg(all(feature = "counter_cycles", target_arch = "arm", target_os = "none", target_has_atomic = "32"))]
+    #[inline(always)]
+    fn elapsed(t: Stamp) -> u64 {
+        (start() as u32).wrapping_sub(t as u32) as u64
+    }
+
+    #[cfg(not(all(
+        feature = "counter_cycles",
+        any(target_arch = "x86_64", all(target_arch = "arm", target_os = "none", target_has_atomic = "32"))
+    )))]
+    #[inline(always)]
+    pub fn start() -> Stamp {
+        0
+    }
+
+    #[cfg(not(all(
+        feature = "counter_cycles",
+        any(target_arch = "x86_64", all(target_arch = "arm", target_os = "none", target_has_atomic = "32"))
+    )))]
+    #[inline(always)]
+    fn elapsed(_t: Stamp) -> u64 {
+        0
+    }
+
+    /// Zero a context's counters (init, prefix, dma_init)
+    pub unsafe fn reset(ctx: *mut NanoSha3_256Ctx) {
+        ptr::write(tally(ctx), Tally { counters: NanoSha3_256Counters::ZERO, pending: 0 });
+    }
+
+    /// Zero a context's counters, `pending` bytes into a block (import)
+    pub unsafe fn resume(ctx: *mut NanoSha3_256Ctx, pending: usize) {
+        ptr::write(tally(ctx), Tally { counters: NanoSha3_256Counters::ZERO, pending: pending as u64 });
+    }
+
+    /// Bytes a context has buffered toward its next block
+    pub unsafe fn pending(ctx: *const NanoSha3_256Ctx) -> u64 {
+        (*tally(ctx)).pending
+    }
+
+    /// Work of absorbing `len` bytes on top of `pending` buffered ones
+    fn absorb_delta(pending: u64, len: usize, t: Stamp) -> NanoSha3_256Counters {
+        let blocks = (pending + len as u64) / RATE;
+        NanoSha3_256Counters { permutations: blocks, full_blocks: blocks, partial_blocks: 0, bytes: len as u64, cycles: elapsed(t) }
+    }
+
+    /// An update of `len` bytes on a context
+    pub unsafe fn absorb(ctx: *mut NanoSha3_256Ctx, len: usize, t: Stamp) {
+        let tally = &mut *tally(ctx);
+        let delta = absorb_delta(tally.pending, len, t);
+        tally.pending = (tally.pending + len as u64) % RATE;
+        add(&mut tally.counters, &delta);
+        add_global(&delta);
+    }
+
+    /// Final on a context: the padded partial block (its counters are kept)
+    pub unsafe fn finish(ctx: *mut NanoSha3_256Ctx, t: Stamp) {
+        let tally = &mut *tally(ctx);
+        let delta = NanoSha3_256Counters { permutations: 1, full_blocks: 0, partial_blocks: 1, bytes: 0, cycles: elapsed(t) };
+        tally.pending = 0;
+        add(&mut tally.counters, &delta);
+        add_global(&delta);
+    }
+
+    /// Copy a context's counters along with its state (clone)
+    pub unsafe fn copy(dst: *mut NanoSha3_256Ctx, src: *const NanoSha3_256Ctx) {
+        ptr::copy_nonoverlapping(tally(src), tally(dst), 1);
+    }
+
+    /// A whole message of `len` bytes hashed without a caller context
+    /// (one-shot, scatter-gather, from_midstate after `pending` bytes)
+    pub fn message(pending: u64, len: usize, t: Stamp) {
+        let mut delta = absorb_delta(pending, len, t);
+        delta.permutations += 1;
+        delta.partial_blocks = 1;
+        add_global(&delta);
+    }
+
+    /// `count` 64-byte Merkle nodes, one padded block each
+    pub fn nodes(count: usize, t: Stamp) {
+        let n = count as u64;
+        add_global(&NanoSha3_256Counters { permutations: n, full_blocks: 0, partial_blocks: n, bytes: 64 * n, cycles: elapsed(t) });
+    }
+
+    /// Read a context's counters, or the library-wide totals
+    #[no_mangle]
+    pub unsafe extern "C" fn nano_sha3_256_get_counters(ctx: *const NanoSha3_256Ctx, out: *mut NanoSha3_256Counters) {
+        if !ctx.is_null() {
+            *out = (*tally(ctx)).counters;
+            return;
+        }
+        let read = |i: usize| GLOBAL[i].load(Ordering::Relaxed) as u64;
+        *out = NanoSha3_256Counters {
+            permutations: read(PERMUTATIONS),
+            full_blocks: read(FULL_BLOCKS),
+            partial_blocks: read(PARTIAL_BLOCKS),
+            bytes: read(BYTES),
+            cycles: read(CYCLES),
+        };
+    }
+
+    /// Zero the library-wide totals
+    #[no_mangle]
+    pub extern "C" fn nano_sha3_256_reset_counters() {
+        for counter in GLOBAL.iter() {
+            counter.store(0, Ordering::Relaxed);
+        }
+    }
+}
+
+// Feature off: no storage, no exports, every hook compiles to nothing
+#[cfg(not(feature = "counters"))]
+mod disabled {
+    use super::super::NanoSha3_256Ctx;
+
+    pub const TALLY_SIZE: usize = 0;
+
+    pub type Stamp = ();
+
+    #[inline(always)]
+    pub fn start() -> Stamp {}
+
+    #[inline(always)]
+    pub unsafe fn reset(_ctx: *mut NanoSha3_256Ctx) {}
+
+    #[inline(always)]
+    pub unsafe fn resume(_ctx: *mut NanoSha3_256Ctx, _pending: usize) {}
+
+    #[inline(always)]
+    pub unsafe fn pending(_ctx: *const NanoSha3_256Ctx) -> u64 {
+        0
+    }
+
+    #[inline(always)]
+    pub unsafe fn absorb(_ctx: *mut NanoSha3_256Ctx, _len: usize, _t: Stamp) {}
+
+    #[inline(always)]
+    pub unsafe fn finish(_ctx: *mut NanoSha3_256Ctx, _t: Stamp) {}
+
+    #[inline(always)]
+    pub unsafe fn copy(_dst: *mut NanoSha3_256Ctx, _src: *const NanoSha3_256Ctx) {}
+
+    #[inline(always)]
+    pub fn message(_pending: u64, _len: usize, _t: Stamp) {}
+
+    #[inline(always)]
+    pub fn nodes(_count: usize, _t: Stamp) {}
+}
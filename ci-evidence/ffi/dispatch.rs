@@ -0,0 +1,426 @@
+// Runtime-dispatched single-message SHA3-256 (intel_x64 and aarch64
+// libraries, cargo feature "dispatch")
+// One binary runs on every host of the architecture: the best permutation
+// for the CPU is picked at the first call and cached as a function pointer.
+// x86_64:
+//   scalar  - baseline x86-64, lane-complemented chi (no ANDN)
+//   bmi2    - BMI1 ANDN chi + BMI2 RORX rotates
+//   avx512  - the 5x5 state as five zmm rows, VPROLVQ rho, VPTERNLOGQ chi
+// AVX2 without AVX-512 runs the bmi2 kernel: AVX2 has no 64-bit rotate or
+// ternary logic, so a single state in ymm rows is slower than scalar RORX.
+// aarch64:
+//   scalar  - baseline ARMv8-A (BIC chi, ROR rotates)
+//   sha3    - ARMv8.2-SHA3: the state in lane 0 of 25 q registers, EOR3
+//             theta parities, RAX1 for D, XAR theta + rho, BCAX chi
+// NANO_SHA3_256_KERNEL=scalar|bmi2|avx512|sha3 or nano_sha3_256_set_kernel()
+// forces a path for benchmarking and per-kernel timing runs.
+
+#[cfg(target_arch = "x86_64")]
+use core::arch::x86_64::*;
+use core::ffi::{c_char, CStr};
+use core::ptr;
+use core::sync::atomic::{AtomicPtr, AtomicU32, Ordering};
+
+#[cfg(target_arch = "aarch64")]
+use super::aarch64::Sha3Neon;
+use super::keccak::{keccak_f1600, Lanes, Word, RATE, RATE_WORDS};
+#[cfg(target_arch = "x86_64")]
+use super::keccak::RC;
+
+/// Kernel IDs (must match NANO_SHA3_256_KERNEL_* in nano_sha3_256.h)
+pub const KERNEL_AUTO: u32 = 0;
+pub const KERNEL_SCALAR: u32 = 1;
+#[cfg(target_arch = "x86_64")]
+pub const KERNEL_BMI2: u32 = 2;
+#[cfg(target_arch = "x86_64")]
+pub const KERNEL_AVX512: u32 = 3;
+#[cfg(target_arch = "aarch64")]
+pub const KERNEL_SHA3: u32 = 4;
+
+type Permute = unsafe fn(&mut [u64; 25]);
+
+/// Cached permutation, null until the first hash or set_kernel call
+static PERMUTE: AtomicPtr<()> = AtomicPtr::new(ptr::null_mut());
+
+/// Kernel ID behind PERMUTE (KERNEL_AUTO while unresolved)
+static ACTIVE: AtomicU32 = AtomicU32::new(KERNEL_AUTO);
+
+#[inline(always)]
+fn as_words(a: &mut [u64; 25]) -> &mut [Word; 25] {
+    unsafe { &mut *(a as *mut [u64; 25] as *mut [Word; 25]) }
+}
+
+/// Lanes held complemented during the scalar permutation
+#[cfg(target_arch = "x86_64")]
+const COMPLEMENTED: [usize; 6] = [1, 2, 8, 12, 17, 20];
+
+/// Baseline x86-64: chi without ANDN costs a NOT per lane; with six lanes
+/// kept complemented the rows need only one NOT each (Keccak team's
+/// lane-complementing transform)
+#[cfg(target_arch = "x86_64")]
+unsafe fn permute_scalar(a: &mut [u64; 25]) {
+    for &i in COMPLEMENTED.iter() {
+        a[i] = !a[i];
+    }
+
+    for rc in RC.iter() {
+        let w = as_words(a);
+        let mut c = [Word(0); 5];
+        for x in 0..5 {
+            c[x] = Word::xor5(w[x], w[x + 5], w[x + 10], w[x + 15], w[x + 20]);
+        }
+        let mut d = [Word(0); 5];
+        for x in 0..5 {
+            d[x] = Word::rax1(c[(x + 4) % 5], c[(x + 1) % 5]);
+        }
+
+        let mut b = [Word(0); 25];
+        b[0] = Word::xor(w[0], d[0]);
+        rho_pi!(Word, w, d, b,
+            (1, 10, 1), (2, 20, 62), (3, 5, 28), (4, 15, 27),
+            (5, 16, 36), (6, 1, 44), (7, 11, 6), (8, 21, 55), (9, 6, 20),
+            (10, 7, 3), (11, 17, 10), (12, 2, 43), (13, 12, 25), (14, 22, 39),
+            (15, 23, 41), (16, 8, 45), (17, 18, 15), (18, 3, 21), (19, 13, 8),
+            (20, 14, 18), (21, 24, 2), (22, 9, 61), (23, 19, 56), (24, 4, 14)
+        );
+        let b: [u64; 25] = core::array::from_fn(|i| b[i].0);
+
+        // Chi on the complemented representation, one row per line
+        *a = [
+            b[0] ^ (b[1] | b[2]), b[1] ^ (!b[2] | b[3]), b[2] ^ (b[3] & b[4]), b[3] ^ (b[4] | b[0]), b[4] ^ (b[0] & b[1]),
+            b[5] ^ (b[6] | b[7]), b[6] ^ (b[7] & b[8]), b[7] ^ (b[8] | !b[9]), b[8] ^ (b[9] | b[5]), b[9] ^ (b[5] & b[6]),
+            b[10] ^ (b[11] | b[12]), b[11] ^ (b[12] & b[13]), b[12] ^ (!b[13] & b[14]), !b[13] ^ (b[14] | b[10]), b[14] ^ (b[10] & b[11]),
+            b[15] ^ (b[16] & b[17]), b[16] ^ (b[17] | b[18]), b[17] ^ (!b[18] | b[19]), !b[18] ^ (b[19] & b[15]), b[19] ^ (b[15] | b[16]),
+            b[20] ^ (!b[21] & b[22]), !b[21] ^ (b[22] | b[23]), b[22] ^ (b[23] & b[24]), b[23] ^ (b[24] | b[20]), b[24] ^ (b[20] & b[21]),
+        ];
+
+        a[0] ^= rc;
+    }
+
+    for &i in COMPLEMENTED.iter() {
+        a[i] = !a[i];
+    }
+}
+
+/// ANDN makes chi one instruction per lane, complementing would only add work
+#[cfg(target_arch = "x86_64")]
+#[target_feature(enable = "bmi1,bmi2")]
+unsafe fn permute_bmi2(a: &mut [u64; 25]) {
+    keccak_f1600::<Word>(as_words(a))
+}
+
+/// Rho rotation counts per row, lanes 5..7 unused
+#[cfg(target_arch = "x86_64")]
+const RHO_ROWS: [[i64; 8]; 5] = [
+    [0, 1, 62, 28, 27, 0, 0, 0],
+    [36, 44, 6, 55, 20, 0, 0, 0],
+    [3, 10, 43, 25, 39, 0, 0, 0],
+    [41, 45, 15, 21, 8, 0, 0, 0],
+    [18, 2, 61, 56, 14, 0, 0, 0],
+];
+
+/// Row y holds lanes x = 0..4 of the state in qwords 0..4
+#[cfg(target_arch = "x86_64")]
+#[target_feature(enable = "avx512f")]
+unsafe fn permute_avx512(a: &mut [u64; 25]) {
+    const ROW: __mmask8 = 0x1F;
+
+    let mut r = [_mm512_setzero_si512(); 5];
+    let mut rho = [_mm512_setzero_si512(); 5];
+    for y in 0..5 {
+        r[y] = _mm512_maskz_loadu_epi64(ROW, a.as_ptr().add(5 * y) as *const i64);
+        rho[y] = _mm512_loadu_si512(RHO_ROWS[y].as_ptr() as *const __m512i);
+    }
+
+    // In-row rotations: qword x takes lane x - 1, x + 1, x + 2
+    let x_minus_1 = _mm512_setr_epi64(4, 0, 1, 2, 3, 5, 6, 7);
+    let x_plus_1 = _mm512_setr_epi64(1, 2, 3, 4, 0, 5, 6, 7);
+    let x_plus_2 = _mm512_setr_epi64(2, 3, 4, 0, 1, 5, 6, 7);
+
+    // Pi gathers new row Y, lane y from row y, lane (3Y + y) mod 5:
+    // rows 0+1 and 2+3 through VPERMT2Q (index 8 + k picks the second row), row 4 masked in
+    let mut pi_01 = [_mm512_setzero_si512(); 5];
+    let mut pi_23 = [_mm512_setzero_si512(); 5];
+    let mut pi_4 = [_mm512_setzero_si512(); 5];
+    for new_y in 0..5 {
+        let src = |y: usize| ((3 * new_y + y) % 5) as i64;
+        pi_01[new_y] = _mm512_setr_epi64(src(0), 8 + src(1), 0, 0, 0, 0, 0, 0);
+        pi_23[new_y] = _mm512_setr_epi64(0, 0, src(2), 8 + src(3), 0, 0, 0, 0);
+        pi_4[new_y] = _mm512_setr_epi64(0, 0, 0, 0, src(4), 0, 0, 0);
+    }
+
+    for rc in RC.iter() {
+        // Theta
+        let c = _mm512_ternarylogic_epi64::<0x96>(_mm512_ternarylogic_epi64::<0x96>(r[0], r[1], r[2]), r[3], r[4]);
+        let d = _mm512_xor_si512(
+            _mm512_permutexvar_epi64(x_minus_1, c),
+            _mm512_rol_epi64::<1>(_mm512_permutexvar_epi64(x_plus_1, c)),
+        );
+
+        // Rho
+        let mut t = [_mm512_setzero_si512(); 5];
+        for y in 0..5 {
+            t[y] = _mm512_rolv_epi64(_mm512_xor_si512(r[y], d), rho[y]);
+        }
+
+        // Pi + Chi, 0xD2: a ^ (!b & c)
+        for new_y in 0..5 {
+            let mut b = _mm512_permutex2var_epi64(t[0], pi_01[new_y], t[1]);
+            b = _mm512_mask_mov_epi64(b, 0b01100, _mm512_permutex2var_epi64(t[2], pi_23[new_y], t[3]));
+            b = _mm512_mask_permutexvar_epi64(b, 0b10000, pi_4[new_y], t[4]);
+            r[new_y] = _mm512_ternarylogic_epi64::<0xD2>(
+                b,
+                _mm512_permutexvar_epi64(x_plus_1, b),
+                _mm512_permutexvar_epi64(x_plus_2, b),
+            );
+        }
+
+        // Iota
+        r[0] = _mm512_xor_si512(r[0], _mm512_maskz_set1_epi64(1, *rc as i64));
+    }
+
+    for y in 0..5 {
+        _mm512_mask_storeu_epi64(a.as_mut_ptr().add(5 * y) as *mut i64, ROW, r[y]);
+    }
+}
+
+/// BIC makes chi one instruction per lane, no complementing needed
+#[cfg(target_arch = "aarch64")]
+unsafe fn permute_scalar(a: &mut [u64; 25]) {
+    keccak_f1600::<Word>(as_words(a))
+}
+
+/// One state on the ARMv8.2-SHA3 instructions, lane 1 of every q register
+/// a don't-care copy; the same rounds as the nano_sha3_256_x2 kernel
+#[cfg(target_arch = "aarch64")]
+#[target_feature(enable = "sha3")]
+unsafe fn permute_sha3(a: &mut [u64; 25]) {
+    let mut v = [Sha3Neon::zero(); 25];
+    for i in 0..25 {
+        v[i] = Sha3Neon::splat(a[i]);
+    }
+    keccak_f1600(&mut v);
+    let mut pair = [0u64; 2];
+    for i in 0..25 {
+        v[i].store(pair.as_mut_ptr());
+        a[i] = pair[0];
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+fn supported(kernel: u32) -> bool {
+    match kernel {
+        KERNEL_SCALAR => true,
+        KERNEL_BMI2 => std::is_x86_feature_detected!("bmi1") && std::is_x86_feature_detected!("bmi2"),
+        KERNEL_AVX512 => std::is_x86_feature_detected!("avx512f"),
+        _ => false,
+    }
+}
+
+#[cfg(target_arch = "aarch64")]
+fn supported(kernel: u32) -> bool {
+    match kernel {
+        KERNEL_SCALAR => true,
+        KERNEL_SHA3 => std::arch::is_aarch64_feature_detected!("sha3"),
+        _ => false,
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+fn kernel_fn(kernel: u32) -> Permute {
+    match kernel {
+        KERNEL_BMI2 => permute_bmi2,
+        KERNEL_AVX512 => permute_avx512,
+        _ => permute_scalar,
+    }
+}
+
+#[cfg(target_arch = "aarch64")]
+fn kernel_fn(kernel: u32) -> Permute {
+    match kernel {
+        KERNEL_SHA3 => permute_sha3,
+        _ => permute_scalar,
+    }
+}
+
+/// Kernels to try, best first (scalar when none is supported)
+#[cfg(target_arch = "x86_64")]
+const PREFERRED: [u32; 2] = [KERNEL_AVX512, KERNEL_BMI2];
+#[cfg(target_arch = "aarch64")]
+const PREFERRED: [u32; 1] = [KERNEL_SHA3];
+
+extern "C" {
+    fn getenv(name: *const c_char) -> *const c_char;
+}
+
+/// Kernel named by NANO_SHA3_256_KERNEL (libc getenv, no heap allocation)
+fn forced_kernel() -> u32 {
+    let value = unsafe { getenv(b"NANO_SHA3_256_KERNEL\0".as_ptr() as *const c_char) };
+    if value.is_null() {
+        return KERNEL_AUTO;
+    }
+    match unsafe { CStr::from_ptr(value) }.to_bytes() {
+        b"scalar" => KERNEL_SCALAR,
+        #[cfg(target_arch = "x86_64")]
+        b"bmi2" => KERNEL_BMI2,
+        #[cfg(target_arch = "x86_64")]
+        b"avx512" => KERNEL_AVX512,
+        #[cfg(target_arch = "aarch64")]
+        b"sha3" => KERNEL_SHA3,
+        _ => KERNEL_AUTO,
+    }
+}
+
+/// Best kernel for this CPU, or the one named by NANO_SHA3_256_KERNEL
+fn detect() -> u32 {
+    let forced = forced_kernel();
+    if forced != KERNEL_AUTO && supported(forced) {
+        return forced;
+    }
+
+    PREFERRED
+        .into_iter()
+        .find(|&k| supported(k))
+        .unwrap_or(KERNEL_SCALAR)
+}
+
+fn install(kernel: u32) {
+    PERMUTE.store(kernel_fn(kernel) as *mut (), Ordering::Relaxed);
+    ACTIVE.store(kernel, Ordering::Relaxed);
+}
+
+/// Select a kernel; KERNEL_AUTO re-runs detection. False if the CPU lacks it.
+pub fn set_kernel(kernel: u32) -> bool {
+    let kernel = if kernel == KERNEL_AUTO { detect() } else { kernel };
+    if !supported(kernel) {
+        return false;
+    }
+    install(kernel);
+    true
+}
+
+/// Kernel in use, resolving it on first use
+pub fn active_kernel() -> u32 {
+    if PERMUTE.load(Ordering::Relaxed).is_null() {
+        install(detect());
+    }
+    ACTIVE.load(Ordering::Relaxed)
+}
+
+#[inline(always)]
+fn permute() -> Permute {
+    let mut f = PERMUTE.load(Ordering::Relaxed);
+    if f.is_null() {
+        // Racing first calls all store the same pointer
+        install(detect());
+        f = PERMUTE.load(Ordering::Relaxed);
+    }
+    unsafe { core::mem::transmute::<*mut (), Permute>(f) }
+}
+
+/// Keccak-f[1600] on the dispatched kernel, for the other sponges (SHAKE, cSHAKE)
+pub fn permute_state(a: &mut [u64; 25]) {
+    unsafe { permute()(a) }
+}
+
+/// XOR one rate block (RATE bytes at `block`, any alignment) and permute
+#[inline(always)]
+unsafe fn absorb_block(state: &mut [u64; 25], block: *const u8, f: Permute) {
+    for i in 0..RATE_WORDS {
+        state[i] ^= u64::from_le(ptr::read_unaligned(block.add(8 * i) as *const u64));
+    }
+    f(state);
+}
+
+/// Streaming SHA3-256 on the dispatched permutation
+///
+/// Same shape as the core crate's `Sha3_256Context` so the C API in
+/// `ffi/mod.rs` wraps either one unchanged.
+pub struct Sha3_256Context {
+    state: [u64; 25],
+    buf: [u8; RATE],
+    buf_len: usize,
+}
+
+impl Sha3_256Context {
+    pub const fn new() -> Self {
+        Sha3_256Context {
+            state: [0; 25],
+            buf: [0; RATE],
+            buf_len: 0,
+        }
+    }
+
+    pub fn update(&mut self, mut data: &[u8]) {
+        let f = permute();
+
+        // Top up a partially filled block first
+        if self.buf_len > 0 {
+            let take = core::cmp::min(RATE - self.buf_len, data.len());
+            self.buf[self.buf_len..self.buf_len + take].copy_from_slice(&data[..take]);
+            self.buf_len += take;
+            data = &data[take..];
+
+            if self.buf_len < RATE {
+                return;
+            }
+            unsafe { absorb_block(&mut self.state, self.buf.as_ptr(), f) };
+            self.buf_len = 0;
+        }
+
+        // Whole blocks straight from the caller's buffer, no copy
+        while data.len() >= RATE {
+            unsafe { absorb_block(&mut self.state, data.as_ptr(), f) };
+            data = &data[RATE..];
+        }
+
+        self.buf[..data.len()].copy_from_slice(data);
+        self.buf_len = data.len();
+    }
+
+    pub fn finalize(mut self) -> [u8; 32] {
+        // SHA3 padding: 0x06 domain byte, 0x80 on the last rate byte
+        for byte in self.buf[self.buf_len..].iter_mut() {
+            *byte = 0;
+        }
+        self.buf[self.buf_len] ^= 0x06;
+        self.buf[RATE - 1] ^= 0x80;
+        unsafe { absorb_block(&mut self.state, self.buf.as_ptr(), permute()) };
+
+        let mut out = [0u8; 32];
+        for i in 0..4 {
+            out[8 * i..8 * i + 8].copy_from_slice(&self.state[i].to_le_bytes());
+        }
+
+        // The buffer may hold message bytes, do not leave it behind
+        unsafe { ptr::write_volatile(&mut self.buf, [0u8; RATE]) };
+        out
+    }
+
+    /// State with the buffered bytes XORed in, and their count
+    /// (nano_sha3_256_export)
+    pub fn export(&self) -> ([u64; 25], usize) {
+        let mut state = self.state;
+        for (i, &byte) in self.buf[..self.buf_len].iter().enumerate() {
+            state[i / 8] ^= (byte as u64) << (8 * (i % 8));
+        }
+        (state, self.buf_len)
+    }
+
+    /// Context continuing from an exported state (`pending` < RATE)
+    /// The pending bytes are already in the state; a zeroed buffer keeps
+    /// them there when the block is absorbed.
+    pub fn import(state: &[u64; 25], pending: usize) -> Self {
+        let mut ctx = Self::new();
+        ctx.state = *state;
+        ctx.buf_len = pending;
+        ctx
+    }
+}
+
+/// One-shot SHA3-256
+pub fn sha3_256(data: &[u8]) -> [u8; 32] {
+    let mut ctx = Sha3_256Context::new();
+    ctx.update(data);
+    ctx.finalize()
+}
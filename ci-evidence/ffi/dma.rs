@@ -0,0 +1,100 @@
+// DMA ping-pong absorb for peripherals streaming into two half-buffers
+// The DMA engine fills buf[0..half) and buf[half..2 half) in a circle while
+// the CPU absorbs the half it just completed. Only whole rate blocks are
+// absorbed, straight from the DMA buffer; a partial block at the end of a
+// half stays where it is and is picked up together with the next half. The
+// one block that wraps from the end of the buffer back to its start is the
+// only input that goes through the context's block buffer, so every input
+// byte is read in place or copied once, never more.
+
+use core::ptr;
+
+use super::{as_context, counters, input_slice, wipe_state, NanoSha3_256Ctx, Sha3_256Context};
+
+/// SHA3-256 rate in bytes
+const RATE: usize = 136;
+
+/// Streaming context plus ping-pong bookkeeping (nano_sha3_256_dma in C)
+#[repr(C)]
+pub struct NanoSha3_256Dma {
+    ctx: NanoSha3_256Ctx,
+    buf: *const u8,
+    half_len: usize,
+    // Offset of the first byte not absorbed yet
+    next: usize,
+    // Half the DMA completes next (0 or 1)
+    half: usize,
+}
+
+/// Absorb the whole blocks of the current half, `valid` bytes of it written
+/// `flush` (end of input) takes the trailing partial block as well.
+/// All branches depend on lengths and offsets, never on data.
+unsafe fn absorb_half(dma: &mut NanoSha3_256Dma, valid: usize, flush: bool) {
+    let t = counters::start();
+    let ctx: &mut Sha3_256Context = &mut *as_context(&mut dma.ctx);
+    let start = dma.half * dma.half_len;
+    let mut next = dma.next;
+    let mut absorbed = 0;
+
+    // A tail left at the end of the second half wraps into the first:
+    // the one block that is not contiguous in the DMA buffer
+    if dma.half == 0 && next != 0 {
+        let tail = 2 * dma.half_len - next;
+        let head = core::cmp::min(RATE - tail, valid);
+        ctx.update(input_slice(dma.buf.add(next), tail));
+        ctx.update(input_slice(dma.buf, head));
+        next = head;
+        absorbed = tail + head;
+    }
+
+    let end = start + valid;
+    let take = if flush { end - next } else { (end - next) / RATE * RATE };
+    ctx.update(input_slice(dma.buf.add(next), take));
+    next += take;
+    counters::absorb(&mut dma.ctx, absorbed + take, t);
+
+    dma.next = if next == 2 * dma.half_len { 0 } else { next };
+    dma.half ^= 1;
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_dma_init_counters")]
+pub unsafe extern "C" fn nano_sha3_256_dma_init(dma: *mut NanoSha3_256Dma, buf: *const u8, half_len: usize) -> i32 {
+    // A wrapped block must fit in one half
+    if buf.is_null() || half_len < RATE {
+        return -1;
+    }
+    ptr::write(as_context(&mut (*dma).ctx), Sha3_256Context::new());
+    counters::reset(&mut (*dma).ctx);
+    (*dma).buf = buf;
+    (*dma).half_len = half_len;
+    (*dma).next = 0;
+    (*dma).half = 0;
+    0
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_dma_absorb_half_counters")]
+pub unsafe extern "C" fn nano_sha3_256_dma_absorb_half(dma: *mut NanoSha3_256Dma) {
+    let dma = &mut *dma;
+    let half_len = dma.half_len;
+    absorb_half(dma, half_len, false);
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_dma_final_counters")]
+pub unsafe extern "C" fn nano_sha3_256_dma_final(dma: *mut NanoSha3_256Dma, tail_len: usize, out: *mut u8) {
+    let dma = &mut *dma;
+    absorb_half(dma, tail_len, true);
+
+    // Same wipe as nano_sha3_256_final, bookkeeping included
+    let t = counters::start();
+    let hash = ptr::read(as_context(&mut dma.ctx)).finalize();
+    wipe_state(&mut dma.ctx);
+    dma.buf = ptr::null();
+    dma.half_len = 0;
+    dma.next = 0;
+    dma.half = 0;
+    ptr::copy_nonoverlapping(hash.as_ptr(), out, hash.len());
+    counters::finish(&mut dma.ctx, t);
+}
@@ -0,0 +1,161 @@
+// Helium (M-profile Vector Extension) multi-lane kernel (cortex_m55_mve library)
+// nano_sha3_256_x4: 4 independent states in 128-bit MVE q registers. MVE
+// has no 64-bit element shifts, so each lane is bit-interleaved as in
+// interleaved.rs: every word is an (even, odd) pair of u32x4 vectors and a
+// 64-bit rotate becomes two 32-bit rotates (VSHL + VSHR + VORR). Chi maps
+// onto VBIC + VEOR. Written on core::simd (Rust has no MVE intrinsics); with
+// target-cpu=cortex-m55 LLVM lowers it to MVE, elsewhere it runs scalar.
+// Single-message hashing stays on the interleaved scalar kernel: one
+// Keccak state has no 4-wide parallelism for MVE to use.
+
+use core::simd::u32x4;
+
+use super::interleaved::to_interleaved;
+use super::keccak::{Lanes, RC};
+use super::multibuf::{node64_level, sha3_256_lanes, xof_absorb_x4, xof_squeeze_x4, XofX4};
+
+/// Iota round constants as [even, odd] words
+const RC_INTERLEAVED: [[u32; 2]; 24] = {
+    let mut table = [[0u32; 2]; 24];
+    let mut i = 0;
+    while i < 24 {
+        let (even, odd) = to_interleaved(RC[i]);
+        table[i] = [even, odd];
+        i += 1;
+    }
+    table
+};
+
+/// One state word of 4 states: even bits and odd bits of each lane
+#[derive(Clone, Copy)]
+struct Helium {
+    even: u32x4,
+    odd: u32x4,
+}
+
+/// 32-bit rotate left by r on every element
+/// r is always a constant after inlining, so both shifts are immediates.
+#[inline(always)]
+fn rotl(x: u32x4, r: u32) -> u32x4 {
+    if r == 0 {
+        x
+    } else {
+        (x << u32x4::splat(r)) | (x >> u32x4::splat(32 - r))
+    }
+}
+
+/// One delta swap step of unzip32/zip32 on every element
+#[inline(always)]
+fn swap<const S: u32>(x: u32x4, mask: u32) -> u32x4 {
+    let t = (x ^ (x >> u32x4::splat(S))) & u32x4::splat(mask);
+    x ^ t ^ (t << u32x4::splat(S))
+}
+
+/// Even bits of each element to the low half, odd bits to the high half
+#[inline(always)]
+fn unzip(x: u32x4) -> u32x4 {
+    let x = swap::<1>(x, 0x2222_2222);
+    let x = swap::<2>(x, 0x0C0C_0C0C);
+    let x = swap::<4>(x, 0x00F0_00F0);
+    swap::<8>(x, 0x0000_FF00)
+}
+
+/// Inverse of unzip (same swaps in reverse order)
+#[inline(always)]
+fn zip(x: u32x4) -> u32x4 {
+    let x = swap::<8>(x, 0x0000_FF00);
+    let x = swap::<4>(x, 0x00F0_00F0);
+    let x = swap::<2>(x, 0x0C0C_0C0C);
+    swap::<1>(x, 0x2222_2222)
+}
+
+impl Lanes for Helium {
+    #[inline(always)]
+    unsafe fn zero() -> Self {
+        Helium { even: u32x4::splat(0), odd: u32x4::splat(0) }
+    }
+
+    #[inline(always)]
+    unsafe fn splat(x: u64) -> Self {
+        let (even, odd) = to_interleaved(x);
+        Helium { even: u32x4::splat(even), odd: u32x4::splat(odd) }
+    }
+
+    #[inline(always)]
+    unsafe fn load(p: *const u64) -> Self {
+        let w = &*(p as *const [u64; 4]);
+        let lo = unzip(u32x4::from_array([w[0] as u32, w[1] as u32, w[2] as u32, w[3] as u32]));
+        let hi = unzip(u32x4::from_array([
+            (w[0] >> 32) as u32,
+            (w[1] >> 32) as u32,
+            (w[2] >> 32) as u32,
+            (w[3] >> 32) as u32,
+        ]));
+        let half = u32x4::splat(16);
+        let low = u32x4::splat(0xFFFF);
+        Helium { even: (lo & low) | (hi << half), odd: (lo >> half) | (hi & !low) }
+    }
+
+    #[inline(always)]
+    unsafe fn store(self, p: *mut u64) {
+        let half = u32x4::splat(16);
+        let low = u32x4::splat(0xFFFF);
+        let lo = zip((self.even & low) | (self.odd << half)).to_array();
+        let hi = zip((self.even >> half) | (self.odd & !low)).to_array();
+        let w = &mut *(p as *mut [u64; 4]);
+        for l in 0..4 {
+            w[l] = lo[l] as u64 | (hi[l] as u64) << 32;
+        }
+    }
+
+    #[inline(always)]
+    unsafe fn xor(a: Self, b: Self) -> Self {
+        Helium { even: a.even ^ b.even, odd: a.odd ^ b.odd }
+    }
+
+    #[inline(always)]
+    unsafe fn rol<const L: i32, const R: i32>(a: Self) -> Self {
+        let r = L as u32;
+        if r % 2 == 0 {
+            Helium { even: rotl(a.even, r / 2), odd: rotl(a.odd, r / 2) }
+        } else {
+            // Odd rotations swap the halves
+            Helium { even: rotl(a.odd, (r + 1) / 2), odd: rotl(a.even, r / 2) }
+        }
+    }
+
+    #[inline(always)]
+    unsafe fn chi(a: Self, b: Self, c: Self) -> Self {
+        // VBIC computes c & !b
+        Helium { even: a.even ^ (c.even & !b.even), odd: a.odd ^ (c.odd & !b.odd) }
+    }
+
+    #[inline(always)]
+    unsafe fn rc(i: usize) -> Self {
+        let [even, odd] = *RC_INTERLEAVED.get_unchecked(i);
+        Helium { even: u32x4::splat(even), odd: u32x4::splat(odd) }
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_x4(out: *const *mut u8, input: *const *const u8, len: *const usize) {
+    let out = &*(out as *const [*mut u8; 4]);
+    let input = &*(input as *const [*const u8; 4]);
+    let len = &*(len as *const [usize; 4]);
+    sha3_256_lanes::<Helium, 4>(out, input, len);
+}
+
+/// 4-way SHAKE absorb-once at rate R, all four states in one permutation
+pub unsafe fn xof_absorb_many<const R: usize>(xof: &mut XofX4, input: &[*const u8; 4], len: usize) {
+    xof_absorb_x4::<Helium, 4, R>(xof, input, len)
+}
+
+/// 4-way SHAKE squeeze of whole rate blocks
+pub unsafe fn xof_squeeze_many<const R: usize>(xof: &mut XofX4, out: &[*mut u8; 4], blocks: usize) {
+    xof_squeeze_x4::<Helium, 4, R>(xof, out, blocks)
+}
+
+/// A Merkle level, 4 nodes per permutation (nano_sha3_256_node64_many)
+pub unsafe fn node64_many(out: *mut u8, input: *const u8, count: usize) {
+    node64_level::<Helium, 4>(out, input, count)
+}
@@ -0,0 +1,351 @@
+// Bit-interleaved Keccak-f[1600] and SHA3-256 sponge for 32-bit cores
+// Speed variant of the Cortex-M4/M33 libraries (cortex_*_fast, cargo
+// feature "interleaved"). Each 64-bit lane is held as two 32-bit words with
+// its even and odd bits, so every 64-bit rotate becomes two 32-bit rotates
+// that Thumb-2 folds into the EOR barrel shifter. Chi maps onto BIC, so
+// lane complementing would only add work on this ISA and is not used.
+// cortex_m0_asm (feature "asm_m0") keeps this context and swaps in the
+// Thumb-1 assembly permutation from ffi/armv6m.rs.
+
+use core::ptr;
+
+use super::node64::{NODE64_PAD_LANE16, NODE64_PAD_LANE8};
+
+/// SHA3-256 rate in bytes (1088 bits)
+const RATE: usize = 136;
+
+/// Rate in 64-bit lanes
+const RATE_LANES: usize = RATE / 8;
+
+/// Iota round constants (64-bit form, interleaved at compile time)
+const RC: [u64; 24] = [
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+    0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+];
+
+/// Iota round constants as [even, odd] words, next to the permutation
+/// ("ramfunc" / "tcm": in RAM or DTCM)
+#[cfg_attr(feature = "ramfunc", link_section = ".ramfunc.rodata")]
+#[cfg_attr(feature = "tcm", link_section = ".dtcm")]
+static RC_INTERLEAVED: [[u32; 2]; 24] = {
+    let mut table = [[0u32; 2]; 24];
+    let mut i = 0;
+    while i < 24 {
+        let (even, odd) = to_interleaved(RC[i]);
+        table[i] = [even, odd];
+        i += 1;
+    }
+    table
+};
+
+/// Even bits of a word to the low half, odd bits to the high half
+#[inline(always)]
+const fn unzip32(mut x: u32) -> u32 {
+    let mut t;
+    t = (x ^ (x >> 1)) & 0x2222_2222;
+    x ^= t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0C0C_0C0C;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 4)) & 0x00F0_00F0;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 8)) & 0x0000_FF00;
+    x ^= t ^ (t << 8);
+    x
+}
+
+/// Inverse of unzip32 (same swaps in reverse order)
+#[inline(always)]
+const fn zip32(mut x: u32) -> u32 {
+    let mut t;
+    t = (x ^ (x >> 8)) & 0x0000_FF00;
+    x ^= t ^ (t << 8);
+    t = (x ^ (x >> 4)) & 0x00F0_00F0;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 2)) & 0x0C0C_0C0C;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 1)) & 0x2222_2222;
+    x ^= t ^ (t << 1);
+    x
+}
+
+/// Split a 64-bit lane into (even bits, odd bits)
+#[inline(always)]
+pub(super) const fn to_interleaved(lane: u64) -> (u32, u32) {
+    let lo = unzip32(lane as u32);
+    let hi = unzip32((lane >> 32) as u32);
+    ((lo & 0xFFFF) | (hi << 16), (lo >> 16) | (hi & 0xFFFF_0000))
+}
+
+/// Rebuild a 64-bit lane from its (even bits, odd bits) words
+#[inline(always)]
+const fn from_interleaved(even: u32, odd: u32) -> u64 {
+    let lo = zip32((even & 0xFFFF) | (odd << 16));
+    let hi = zip32((even >> 16) | (odd & 0xFFFF_0000));
+    (lo as u64) | ((hi as u64) << 32)
+}
+
+/// 64-bit rotate left by R on an interleaved (even, odd) pair
+#[cfg(not(all(feature = "asm_m0", target_arch = "arm", target_os = "none")))]
+#[inline(always)]
+fn rol<const R: u32>(even: u32, odd: u32) -> (u32, u32) {
+    if R % 2 == 0 {
+        (even.rotate_left(R / 2), odd.rotate_left(R / 2))
+    } else {
+        // Odd rotations swap the halves
+        (odd.rotate_left((R + 1) / 2), even.rotate_left(R / 2))
+    }
+}
+
+/// Theta + Rho + Pi with literal rotation counts:
+/// b[dst] = rol(a[src] ^ d[src % 5], rot) on both halves
+#[cfg(not(all(feature = "asm_m0", target_arch = "arm", target_os = "none")))]
+macro_rules! rho_pi_interleaved {
+    ($a:ident, $d:ident, $b:ident, $( ($src:literal, $dst:literal, $rot:literal) ),* ) => {
+        $(
+            let (even, odd) = rol::<$rot>(
+                $a[2 * $src] ^ $d[2 * ($src % 5)],
+                $a[2 * $src + 1] ^ $d[2 * ($src % 5) + 1],
+            );
+            $b[2 * $dst] = even;
+            $b[2 * $dst + 1] = odd;
+        )*
+    };
+}
+
+/// One straight-line Keccak round; lane i lives in a[2i] (even) / a[2i + 1] (odd)
+#[cfg(not(all(feature = "asm_m0", target_arch = "arm", target_os = "none")))]
+#[inline(always)]
+fn round(a: &mut [u32; 50], rc: &[u32; 2]) {
+    // Theta: column parities and the per-column mix word
+    let mut c = [0u32; 10];
+    for x in 0..5 {
+        for h in 0..2 {
+            c[2 * x + h] = a[2 * x + h]
+                ^ a[2 * (x + 5) + h]
+                ^ a[2 * (x + 10) + h]
+                ^ a[2 * (x + 15) + h]
+                ^ a[2 * (x + 20) + h];
+        }
+    }
+    let mut d = [0u32; 10];
+    for x in 0..5 {
+        let (even, odd) = rol::<1>(c[2 * ((x + 1) % 5)], c[2 * ((x + 1) % 5) + 1]);
+        d[2 * x] = c[2 * ((x + 4) % 5)] ^ even;
+        d[2 * x + 1] = c[2 * ((x + 4) % 5) + 1] ^ odd;
+    }
+
+    // Rho + Pi: b[y + 5((2x + 3y) mod 5)] = rol(a[x + 5y], r[x][y])
+    let mut b = [0u32; 50];
+    b[0] = a[0] ^ d[0];
+    b[1] = a[1] ^ d[1];
+    rho_pi_interleaved!(a, d, b,
+        (1, 10, 1), (2, 20, 62), (3, 5, 28), (4, 15, 27),
+        (5, 16, 36), (6, 1, 44), (7, 11, 6), (8, 21, 55), (9, 6, 20),
+        (10, 7, 3), (11, 17, 10), (12, 2, 43), (13, 12, 25), (14, 22, 39),
+        (15, 23, 41), (16, 8, 45), (17, 18, 15), (18, 3, 21), (19, 13, 8),
+        (20, 14, 18), (21, 24, 2), (22, 9, 61), (23, 19, 56), (24, 4, 14)
+    );
+
+    // Chi: a ^ (!b & c) is a single BIC + EOR per half
+    for y in 0..5 {
+        for x in 0..5 {
+            for h in 0..2 {
+                a[2 * (x + 5 * y) + h] = b[2 * (x + 5 * y) + h]
+                    ^ (!b[2 * ((x + 1) % 5 + 5 * y) + h] & b[2 * ((x + 2) % 5 + 5 * y) + h]);
+            }
+        }
+    }
+
+    // Iota
+    a[0] ^= rc[0];
+    a[1] ^= rc[1];
+}
+
+/// cortex_m0_asm: the Thumb-1 assembly permutation (ffi/armv6m.rs)
+#[cfg(all(feature = "asm_m0", target_arch = "arm", target_os = "none"))]
+#[inline(always)]
+fn keccak_f1600(a: &mut [u32; 50]) {
+    super::armv6m::keccak_f1600(a, &RC_INTERLEAVED);
+}
+
+/// Keccak-f[1600] on an interleaved state, two unrolled rounds per iteration
+/// Kept out of line under "ramfunc" / "tcm" so all of it runs from RAM or ITCM.
+#[cfg(not(all(feature = "asm_m0", target_arch = "arm", target_os = "none")))]
+#[cfg_attr(any(feature = "ramfunc", feature = "tcm"), inline(never))]
+#[cfg_attr(feature = "ramfunc", link_section = ".ramfunc")]
+#[cfg_attr(feature = "tcm", link_section = ".itcm")]
+fn keccak_f1600(a: &mut [u32; 50]) {
+    let mut r = 0;
+    while r < 24 {
+        round(a, &RC_INTERLEAVED[r]);
+        round(a, &RC_INTERLEAVED[r + 1]);
+        r += 2;
+    }
+}
+
+/// XOR one rate block (RATE bytes at `block`, any alignment) into the state
+/// 8-byte aligned blocks (DMA buffers, mmap'd images) take whole-word loads
+/// (LDRD/LDM); unaligned LDRs split into several bus accesses on M4/M33.
+/// The branch depends on the buffer address only, never on its contents.
+#[inline(always)]
+unsafe fn absorb_block(state: &mut [u32; 50], block: *const u8) {
+    if block as usize % 8 == 0 {
+        let lanes = &*(block as *const [u64; RATE_LANES]);
+        for i in 0..RATE_LANES {
+            xor_lane(state, i, u64::from_le(lanes[i]));
+        }
+    } else {
+        for i in 0..RATE_LANES {
+            xor_lane(state, i, u64::from_le(ptr::read_unaligned(block.add(8 * i) as *const u64)));
+        }
+    }
+}
+
+#[inline(always)]
+fn xor_lane(state: &mut [u32; 50], i: usize, lane: u64) {
+    let (even, odd) = to_interleaved(lane);
+    state[2 * i] ^= even;
+    state[2 * i + 1] ^= odd;
+}
+
+/// Streaming SHA3-256 on the interleaved permutation
+///
+/// Same shape as the core crate's `Sha3_256Context` so the C API in
+/// `ffi/mod.rs` wraps either one unchanged.
+pub struct Sha3_256Context {
+    state: [u32; 50],
+    buf: [u8; RATE],
+    buf_len: usize,
+}
+
+impl Sha3_256Context {
+    pub const fn new() -> Self {
+        Sha3_256Context {
+            state: [0; 50],
+            buf: [0; RATE],
+            buf_len: 0,
+        }
+    }
+
+    pub fn update(&mut self, mut data: &[u8]) {
+        // Top up a partially filled block first
+        if self.buf_len > 0 {
+            let take = core::cmp::min(RATE - self.buf_len, data.len());
+            self.buf[self.buf_len..self.buf_len + take].copy_from_slice(&data[..take]);
+            self.buf_len += take;
+            data = &data[take..];
+
+            if self.buf_len < RATE {
+                return;
+            }
+            unsafe { absorb_block(&mut self.state, self.buf.as_ptr()) };
+            keccak_f1600(&mut self.state);
+            self.buf_len = 0;
+        }
+
+        // Whole blocks straight from the caller's buffer, no copy
+        while data.len() >= RATE {
+            unsafe { absorb_block(&mut self.state, data.as_ptr()) };
+            keccak_f1600(&mut self.state);
+            data = &data[RATE..];
+        }
+
+        self.buf[..data.len()].copy_from_slice(data);
+        self.buf_len = data.len();
+    }
+
+    pub fn finalize(mut self) -> [u8; 32] {
+        // SHA3 padding: 0x06 domain byte, 0x80 on the last rate byte
+        for byte in self.buf[self.buf_len..].iter_mut() {
+            *byte = 0;
+        }
+        self.buf[self.buf_len] ^= 0x06;
+        self.buf[RATE - 1] ^= 0x80;
+        unsafe { absorb_block(&mut self.state, self.buf.as_ptr()) };
+        keccak_f1600(&mut self.state);
+
+        let mut out = [0u8; 32];
+        for i in 0..4 {
+            let lane = from_interleaved(self.state[2 * i], self.state[2 * i + 1]);
+            out[8 * i..8 * i + 8].copy_from_slice(&lane.to_le_bytes());
+        }
+
+        // The buffer may hold message bytes, do not leave it behind
+        unsafe { ptr::write_volatile(&mut self.buf, [0u8; RATE]) };
+        out
+    }
+
+    /// Plain 64-bit state with the buffered bytes XORed in, and their count
+    /// (nano_sha3_256_export)
+    pub fn export(&self) -> ([u64; 25], usize) {
+        let mut state = [0u64; 25];
+        for (i, lane) in state.iter_mut().enumerate() {
+            *lane = from_interleaved(self.state[2 * i], self.state[2 * i + 1]);
+        }
+        for (i, &byte) in self.buf[..self.buf_len].iter().enumerate() {
+            state[i / 8] ^= (byte as u64) << (8 * (i % 8));
+        }
+        (state, self.buf_len)
+    }
+
+    /// Context continuing from an exported state (`pending` < RATE)
+    /// The pending bytes are already in the state; a zeroed buffer keeps
+    /// them there when the block is absorbed.
+    pub fn import(state: &[u64; 25], pending: usize) -> Self {
+        let mut ctx = Self::new();
+        for (i, &lane) in state.iter().enumerate() {
+            let (even, odd) = to_interleaved(lane);
+            ctx.state[2 * i] = even;
+            ctx.state[2 * i + 1] = odd;
+        }
+        ctx.buf_len = pending;
+        ctx
+    }
+}
+
+/// Keccak-f[1600] on a plain 64-bit state (the SHAKE / cSHAKE / KMAC sponge)
+/// Runs the permutation above instead of a second, 64-bit copy of it.
+#[inline(never)]
+pub fn permute_state(a: &mut [u64; 25]) {
+    let mut state = [0u32; 50];
+    for (i, &lane) in a.iter().enumerate() {
+        let (even, odd) = to_interleaved(lane);
+        state[2 * i] = even;
+        state[2 * i + 1] = odd;
+    }
+    keccak_f1600(&mut state);
+    for (i, lane) in a.iter_mut().enumerate() {
+        *lane = from_interleaved(state[2 * i], state[2 * i + 1]);
+    }
+}
+
+/// One-shot SHA3-256
+pub fn sha3_256(data: &[u8]) -> [u8; 32] {
+    let mut ctx = Sha3_256Context::new();
+    ctx.update(data);
+    ctx.finalize()
+}
+
+/// SHA3-256 of one 64-byte Merkle node (see ffi/node64.rs)
+pub fn sha3_256_node64(input: &[u8; 64]) -> [u8; 32] {
+    let mut state = [0u32; 50];
+    unsafe {
+        for i in 0..8 {
+            xor_lane(&mut state, i, u64::from_le(ptr::read_unaligned(input.as_ptr().add(8 * i) as *const u64)));
+        }
+    }
+    xor_lane(&mut state, 8, NODE64_PAD_LANE8);
+    xor_lane(&mut state, 16, NODE64_PAD_LANE16);
+    keccak_f1600(&mut state);
+
+    let mut out = [0u8; 32];
+    for i in 0..4 {
+        let lane = from_interleaved(state[2 * i], state[2 * i + 1]);
+        out[8 * i..8 * i + 8].copy_from_slice(&lane.to_le_bytes());
+    }
+    out
+}
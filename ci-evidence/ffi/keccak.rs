@@ -0,0 +1,183 @@
+// Lane-generic Keccak-f[1600] for the multi-buffer kernels
+// Each `Lanes` value holds the same state word of several independent
+// states, so one permutation call advances all of them at once.
+
+/// SHA3-256 rate in bytes (1088 bits)
+pub const RATE: usize = 136;
+
+/// Rate in 64-bit lanes
+pub const RATE_WORDS: usize = RATE / 8;
+
+/// Iota round constants
+pub const RC: [u64; 24] = [
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+    0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+];
+
+/// One state word across N parallel Keccak states
+///
+/// Implementations are `#[inline(always)]` wrappers over SIMD intrinsics;
+/// callers must run inside a function compiled with the matching
+/// `#[target_feature]`. The fused operations default to their plain
+/// XOR/rotate form and map 1:1 onto the ARMv8.2-SHA3 instructions
+/// (EOR3, RAX1, XAR, BCAX) where a target has them.
+pub trait Lanes: Copy {
+    unsafe fn zero() -> Self;
+    unsafe fn splat(x: u64) -> Self;
+    /// Load N words, one per state, from `p[0..N]`
+    unsafe fn load(p: *const u64) -> Self;
+    /// Store N words, one per state, to `p[0..N]`
+    unsafe fn store(self, p: *mut u64);
+    unsafe fn xor(a: Self, b: Self) -> Self;
+    /// Rotate left by L bits; R is always 64 - L (shift-based kernels need both)
+    unsafe fn rol<const L: i32, const R: i32>(a: Self) -> Self;
+    /// a ^ (!b & c)
+    unsafe fn chi(a: Self, b: Self, c: Self) -> Self;
+
+    /// Iota constant of round i, for kernels that keep words in another form
+    #[inline(always)]
+    unsafe fn rc(i: usize) -> Self {
+        Self::splat(*RC.get_unchecked(i))
+    }
+
+    #[inline(always)]
+    unsafe fn xor5(a: Self, b: Self, c: Self, d: Self, e: Self) -> Self {
+        Self::xor(Self::xor(Self::xor(a, b), Self::xor(c, d)), e)
+    }
+
+    /// a ^ rol(b, 1) (theta column mix, RAX1)
+    #[inline(always)]
+    unsafe fn rax1(a: Self, b: Self) -> Self {
+        Self::xor(a, Self::rol::<1, 63>(b))
+    }
+
+    /// rol(a ^ d, L) (theta + rho on one word, XAR)
+    #[inline(always)]
+    unsafe fn xor_rol<const L: i32, const R: i32>(a: Self, d: Self) -> Self {
+        Self::rol::<L, R>(Self::xor(a, d))
+    }
+}
+
+/// One 64-bit state word, scalar `Lanes` for the generic permutation
+#[derive(Clone, Copy)]
+#[repr(transparent)]
+pub struct Word(pub u64);
+
+impl Lanes for Word {
+    #[inline(always)]
+    unsafe fn zero() -> Self {
+        Word(0)
+    }
+
+    #[inline(always)]
+    unsafe fn splat(x: u64) -> Self {
+        Word(x)
+    }
+
+    #[inline(always)]
+    unsafe fn load(p: *const u64) -> Self {
+        Word(*p)
+    }
+
+    #[inline(always)]
+    unsafe fn store(self, p: *mut u64) {
+        *p = self.0
+    }
+
+    #[inline(always)]
+    unsafe fn xor(a: Self, b: Self) -> Self {
+        Word(a.0 ^ b.0)
+    }
+
+    #[inline(always)]
+    unsafe fn rol<const L: i32, const R: i32>(a: Self) -> Self {
+        Word(a.0.rotate_left(L as u32))
+    }
+
+    #[inline(always)]
+    unsafe fn chi(a: Self, b: Self, c: Self) -> Self {
+        Word(a.0 ^ (!b.0 & c.0))
+    }
+}
+
+/// Theta + Rho + Pi with literal rotation counts, so every rotate is an
+/// immediate: b[dst] = rol(a[src] ^ d[src % 5], rot)
+macro_rules! rho_pi {
+    ($v:ident, $a:ident, $d:ident, $b:ident, $( ($src:literal, $dst:literal, $rot:literal) ),* ) => {
+        $( $b[$dst] = $v::xor_rol::<$rot, { 64 - $rot }>($a[$src], $d[$src % 5]); )*
+    };
+}
+
+/// Rounds per iteration of the permutation loop: 1 (fully looped), 2, or
+/// 24 (straight-line), picked by the "unroll2" / "unroll24" cargo features.
+/// The build matrix in verify-build-staticlibs.sh measures each setting.
+#[cfg(feature = "unroll24")]
+pub const UNROLL: usize = 24;
+#[cfg(all(feature = "unroll2", not(feature = "unroll24")))]
+pub const UNROLL: usize = 2;
+#[cfg(not(any(feature = "unroll2", feature = "unroll24")))]
+pub const UNROLL: usize = 1;
+
+/// Expand one `round` call per listed offset from `$i`
+/// (i + k < 24 always: i steps by UNROLL, which divides 24)
+macro_rules! rounds {
+    ($v:ident, $a:ident, $i:ident; $( $k:literal )*) => {
+        $( round::<$v>($a, $i + $k); )*
+    };
+}
+
+/// Keccak-f[1600] on every state held in `a`, UNROLL rounds per iteration
+#[inline(always)]
+pub unsafe fn keccak_f1600<V: Lanes>(a: &mut [V; 25]) {
+    let mut i = 0;
+    while i < 24 {
+        if UNROLL == 24 {
+            rounds!(V, a, i; 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23);
+        } else if UNROLL == 2 {
+            rounds!(V, a, i; 0 1);
+        } else {
+            rounds!(V, a, i; 0);
+        }
+        i += UNROLL;
+    }
+}
+
+/// Keccak-f[1600] round `i` (0 to 23)
+#[inline(always)]
+unsafe fn round<V: Lanes>(a: &mut [V; 25], i: usize) {
+    // Theta: column parities and the per-column mix word
+    let mut c = [V::zero(); 5];
+    for x in 0..5 {
+        c[x] = V::xor5(a[x], a[x + 5], a[x + 10], a[x + 15], a[x + 20]);
+    }
+    let mut d = [V::zero(); 5];
+    for x in 0..5 {
+        d[x] = V::rax1(c[(x + 4) % 5], c[(x + 1) % 5]);
+    }
+
+    // Rho + Pi: b[y + 5((2x + 3y) mod 5)] = rol(a[x + 5y], r[x][y]),
+    // with the theta XOR folded into each rotate
+    let mut b = [V::zero(); 25];
+    b[0] = V::xor(a[0], d[0]);
+    rho_pi!(V, a, d, b,
+        (1, 10, 1), (2, 20, 62), (3, 5, 28), (4, 15, 27),
+        (5, 16, 36), (6, 1, 44), (7, 11, 6), (8, 21, 55), (9, 6, 20),
+        (10, 7, 3), (11, 17, 10), (12, 2, 43), (13, 12, 25), (14, 22, 39),
+        (15, 23, 41), (16, 8, 45), (17, 18, 15), (18, 3, 21), (19, 13, 8),
+        (20, 14, 18), (21, 24, 2), (22, 9, 61), (23, 19, 56), (24, 4, 14)
+    );
+
+    // Chi
+    for y in 0..5 {
+        for x in 0..5 {
+            a[x + 5 * y] = V::chi(b[x + 5 * y], b[(x + 1) % 5 + 5 * y], b[(x + 2) % 5 + 5 * y]);
+        }
+    }
+
+    // Iota
+    a[0] = V::xor(a[0], V::rc(i));
+}
@@ -0,0 +1,107 @@
+// KMAC256 (NIST SP 800-185) on the shared Keccak sponge
+// KMAC256(K, X, L, S) = cSHAKE256(bytepad(encode_string(K), 136) || X ||
+// right_encode(L), L, "KMAC", S). Everything up to X depends on the key and
+// customization only, so it is absorbed once into a keyed context; each
+// frame then starts from a copy of that context. No heap, no branches on
+// key or message bytes.
+
+use core::mem::{align_of, size_of};
+use core::ptr;
+use core::slice;
+
+use super::input_slice;
+use super::sponge::{cshake256, left_encode, right_encode, Sponge};
+
+/// cSHAKE domain byte ("00" suffix plus pad10*1)
+const CSHAKE_DOMAIN: u8 = 0x04;
+
+/// Keyed or in-progress KMAC256 state
+pub type Kmac256 = Sponge<136>;
+
+/// Keyed context: cSHAKE256("KMAC", S) prefix plus bytepad(encode_string(K), 136)
+pub fn kmac256_key(key: &[u8], custom: &[u8]) -> Kmac256 {
+    let mut sponge = cshake256(b"KMAC", custom);
+    sponge.absorb(left_encode(136).as_slice());
+    sponge.absorb(left_encode(8 * key.len() as u64).as_slice());
+    sponge.absorb(key);
+    sponge.pad_block();
+    sponge
+}
+
+/// Finish a frame: right_encode(L), cSHAKE padding, squeeze L = 8 * out.len() bits
+pub fn kmac256_finish(sponge: &mut Kmac256, out: &mut [u8]) {
+    sponge.absorb(right_encode(8 * out.len() as u64).as_slice());
+    sponge.finish(CSHAKE_DOMAIN);
+    sponge.squeeze(out);
+}
+
+/// Must match NANO_KMAC256_CTX_SIZE in nano_sha3_256.h
+pub const NANO_KMAC256_CTX_SIZE: usize = 208;
+
+/// Caller-allocated storage for a Kmac256 (nano_kmac256_ctx in C)
+#[repr(C, align(8))]
+pub struct NanoKmac256Ctx {
+    opaque: [u64; NANO_KMAC256_CTX_SIZE / 8],
+}
+
+const _: () = assert!(size_of::<Kmac256>() <= NANO_KMAC256_CTX_SIZE);
+const _: () = assert!(align_of::<Kmac256>() <= align_of::<NanoKmac256Ctx>());
+
+#[inline(always)]
+fn as_kmac(ctx: *mut NanoKmac256Ctx) -> *mut Kmac256 {
+    ctx as *mut Kmac256
+}
+
+#[inline(always)]
+unsafe fn output_slice<'a>(out: *mut u8, len: usize) -> &'a mut [u8] {
+    if len == 0 {
+        &mut []
+    } else {
+        slice::from_raw_parts_mut(out, len)
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_kmac256_init(
+    keyed: *mut NanoKmac256Ctx,
+    key: *const u8,
+    key_len: usize,
+    custom: *const u8,
+    custom_len: usize,
+) {
+    ptr::write(as_kmac(keyed), kmac256_key(input_slice(key, key_len), input_slice(custom, custom_len)));
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_kmac256_clone(dst: *mut NanoKmac256Ctx, src: *const NanoKmac256Ctx) {
+    if dst as *const NanoKmac256Ctx != src {
+        ptr::copy_nonoverlapping(src as *const Kmac256, as_kmac(dst), 1);
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_kmac256_update(ctx: *mut NanoKmac256Ctx, input: *const u8, len: usize) {
+    (*as_kmac(ctx)).absorb(input_slice(input, len));
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_kmac256_final(ctx: *mut NanoKmac256Ctx, out: *mut u8, out_len: usize) {
+    kmac256_finish(&mut *as_kmac(ctx), output_slice(out, out_len));
+    // The state is key-derived, do not leave it behind
+    ptr::write_volatile(ctx, NanoKmac256Ctx { opaque: [0; NANO_KMAC256_CTX_SIZE / 8] });
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_kmac256(
+    out: *mut u8,
+    out_len: usize,
+    keyed: *const NanoKmac256Ctx,
+    input: *const u8,
+    len: usize,
+) {
+    // Frame MAC from a stack copy, the keyed context stays reusable
+    let mut frame = ptr::read(keyed as *const Kmac256);
+    frame.absorb(input_slice(input, len));
+    kmac256_finish(&mut frame, output_slice(out, out_len));
+    ptr::write_volatile(&mut frame, Sponge::new());
+}
@@ -0,0 +1,128 @@
+// Low-RAM SHA3-256 (cargo feature "lowram", cortex_m0_lowram library)
+// For interrupt handlers and small RTOS task stacks: the 25-lane state
+// lives only in the caller's context, input is XORed straight into it
+// (no block staging buffer), and the permutation works in place, so no
+// second state-sized array ever reaches the stack.
+//
+// Permutation scratch is the five theta column parities plus one word
+// in flight through Rho + Pi and two saved words per Chi row.
+
+use core::ptr;
+
+use super::keccak::RC;
+use super::sponge::Sponge;
+
+// The permutation and its tables stay together: flash by default, RAM or
+// the TCMs under "ramfunc" / "tcm" (see ffi/mod.rs)
+
+/// Round constants for the permutation below
+#[cfg_attr(feature = "ramfunc", link_section = ".ramfunc.rodata")]
+#[cfg_attr(feature = "tcm", link_section = ".dtcm")]
+static ROUND_CONSTANTS: [u64; 24] = RC;
+
+/// Rho rotation for each step of the Pi cycle below
+#[cfg_attr(feature = "ramfunc", link_section = ".ramfunc.rodata")]
+#[cfg_attr(feature = "tcm", link_section = ".dtcm")]
+static RHO: [u8; 24] = [
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44,
+];
+
+/// Pi as one 24-lane cycle starting at lane 1 (lane 0 is a fixed point)
+#[cfg_attr(feature = "ramfunc", link_section = ".ramfunc.rodata")]
+#[cfg_attr(feature = "tcm", link_section = ".dtcm")]
+static PI: [u8; 24] = [
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1,
+];
+
+/// In-place Keccak-f[1600], shared by every sponge in lowram builds
+#[inline(never)]
+#[cfg_attr(feature = "ramfunc", link_section = ".ramfunc")]
+#[cfg_attr(feature = "tcm", link_section = ".itcm")]
+pub fn permute_state(a: &mut [u64; 25]) {
+    for &rc in ROUND_CONSTANTS.iter() {
+        // Theta: column parities, then XOR each column's mix word in place
+        let mut c = [0u64; 5];
+        for x in 0..5 {
+            c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+        }
+        for x in 0..5 {
+            let d = c[(x + 4) % 5] ^ c[(x + 1) % 5].rotate_left(1);
+            for y in 0..5 {
+                a[x + 5 * y] ^= d;
+            }
+        }
+
+        // Rho + Pi: walk the Pi cycle carrying one displaced lane
+        let mut carry = a[1];
+        for (&dst, &rot) in PI.iter().zip(RHO.iter()) {
+            let next = a[dst as usize];
+            a[dst as usize] = carry.rotate_left(rot as u32);
+            carry = next;
+        }
+
+        // Chi row by row; only the first two lanes are overwritten before use
+        for row in a.chunks_exact_mut(5) {
+            let (a0, a1) = (row[0], row[1]);
+            row[0] ^= !row[1] & row[2];
+            row[1] ^= !row[2] & row[3];
+            row[2] ^= !row[3] & row[4];
+            row[3] ^= !row[4] & a0;
+            row[4] ^= !a0 & a1;
+        }
+
+        // Iota
+        a[0] ^= rc;
+    }
+}
+
+/// Streaming SHA3-256 with the state only in this context
+///
+/// Same shape as the core crate's `Sha3_256Context` so the C API in
+/// `ffi/mod.rs` wraps either one; `nano_sha3_256_final` uses
+/// `finalize_into` so the context is never copied onto the stack.
+pub struct Sha3_256Context {
+    sponge: Sponge<136>,
+}
+
+impl Sha3_256Context {
+    pub const fn new() -> Self {
+        Sha3_256Context { sponge: Sponge::new() }
+    }
+
+    pub fn update(&mut self, data: &[u8]) {
+        self.sponge.absorb(data);
+    }
+
+    /// Pad, squeeze the digest into `out` and wipe the state, all in place
+    pub fn finalize_into(&mut self, out: &mut [u8; 32]) {
+        self.sponge.finish(0x06);
+        self.sponge.squeeze(out);
+
+        // The state still holds the rest of the squeezed block
+        unsafe { ptr::write_volatile(&mut self.sponge, Sponge::new()) };
+    }
+
+    pub fn finalize(mut self) -> [u8; 32] {
+        let mut out = [0u8; 32];
+        self.finalize_into(&mut out);
+        out
+    }
+
+    /// State and bytes absorbed into the current block (nano_sha3_256_export)
+    pub fn export(&self) -> ([u64; 25], usize) {
+        self.sponge.lanes()
+    }
+
+    /// Context continuing from an exported state (`pending` < RATE)
+    pub fn import(state: &[u64; 25], pending: usize) -> Self {
+        Sha3_256Context { sponge: Sponge::from_lanes(*state, pending) }
+    }
+}
+
+/// One-shot SHA3-256 (the context sits on this frame; callers on a tight
+/// stack should use the streaming API on a context they own)
+pub fn sha3_256(data: &[u8]) -> [u8; 32] {
+    let mut ctx = Sha3_256Context::new();
+    ctx.update(data);
+    ctx.finalize()
+}
@@ -0,0 +1,300 @@
+// C ABI layer for nano-sha3-256 static libraries
+// Copied into every standalone project by verify-build-staticlibs.sh.
+// Mirrors ci-evidence/nano_sha3_256.h - keep both in sync.
+
+use core::mem::{align_of, size_of};
+use core::ptr;
+use core::slice;
+
+// Lane-generic Keccak: multi-buffer kernels (nano_sha3_256_x4/_x8 on x86_64,
+// nano_sha3_256_x2 on aarch64 and armv7 Linux, nano_sha3_256_x4 on the
+// Helium library), the intel_x64 / aarch64 dispatcher and the scalar permutation behind
+// the SHAKE sponges on every target (other Cortex-M builds use only the
+// scalar path)
+#[cfg_attr(not(any(target_arch = "x86_64", target_arch = "aarch64", all(target_arch = "arm", target_os = "linux"))), allow(dead_code))]
+#[macro_use]
+mod keccak;
+#[cfg(any(target_arch = "x86_64", target_arch = "aarch64", all(target_arch = "arm", target_os = "linux")))]
+mod multibuf;
+#[cfg(all(feature = "helium", target_arch = "arm", target_os = "none"))]
+#[allow(dead_code)]
+mod multibuf;
+#[cfg(target_arch = "x86_64")]
+mod x86;
+#[cfg(target_arch = "aarch64")]
+mod aarch64;
+#[cfg(all(target_arch = "arm", target_os = "linux"))]
+mod armv7;
+// cortex_m55_mve: 4 states in MVE q registers (feature "helium")
+#[cfg(all(feature = "helium", target_arch = "arm", target_os = "none"))]
+mod helium;
+
+// Rate-generic sponge: SHAKE128/SHAKE256 and KMAC256 everywhere, plus
+// SP 800-185 tree hashing on the Linux libraries (std threads)
+mod sponge;
+mod shake;
+mod kmac;
+// Single-block 64-byte Merkle node kernel (nano_sha3_256_node64)
+mod node64;
+// DMA ping-pong absorb from two peripheral half-buffers (nano_sha3_256_dma_*)
+mod dma;
+// Permutation / block / byte / cycle counters (feature "counters")
+mod counters;
+// Portable streaming context checkpoints (nano_sha3_256_export / _import);
+// the core crate's context is opaque, so only the in-tree backends have them
+#[cfg(any(feature = "interleaved", feature = "dispatch", feature = "scalar", feature = "lowram"))]
+mod checkpoint;
+#[cfg(any(target_arch = "x86_64", target_arch = "aarch64", all(target_arch = "arm", target_os = "linux")))]
+mod parallel;
+// Work-stealing batch hasher for many independent messages (nano_sha3_256_batch)
+#[cfg(any(target_arch = "x86_64", target_arch = "aarch64", all(target_arch = "arm", target_os = "linux")))]
+mod batch;
+// 4-way SHAKE absorb-once / squeeze-blocks on the multi-buffer kernels
+#[cfg(any(
+    target_arch = "x86_64",
+    target_arch = "aarch64",
+    all(target_arch = "arm", target_os = "linux"),
+    all(feature = "helium", target_arch = "arm", target_os = "none")
+))]
+mod shake_x4;
+
+// Libraries built without the core crate bring their own context:
+// cortex_*_fast and cortex_m0_asm the bit-interleaved one (feature
+// "interleaved", plus "asm_m0" for the Thumb-1 permutation), intel_x64 and
+// aarch64 the runtime-dispatched one (feature "dispatch"), the unroll profile builds
+// the scalar sponge (feature "scalar"), cortex_m0_lowram the in-place one
+// (feature "lowram"). The rest wrap the core's.
+#[cfg(feature = "interleaved")]
+mod interleaved;
+// cortex_m0_asm: Thumb-1 assembly permutation under the interleaved context
+#[cfg(all(feature = "asm_m0", target_arch = "arm", target_os = "none"))]
+mod armv6m;
+#[cfg(feature = "interleaved")]
+use interleaved as backend;
+#[cfg(feature = "dispatch")]
+mod dispatch;
+#[cfg(feature = "dispatch")]
+use dispatch as backend;
+#[cfg(feature = "scalar")]
+mod scalar;
+#[cfg(feature = "scalar")]
+use scalar as backend;
+#[cfg(feature = "lowram")]
+mod lowram;
+#[cfg(feature = "lowram")]
+use lowram as backend;
+
+// Permutation placement (features "ramfunc" / "tcm"): the SHA3-256
+// permutation and its constant tables go to .ramfunc / .ramfunc.rodata or
+// .itcm / .dtcm instead of flash, for the firmware's linker script to load
+// into SRAM or the tightly coupled memories. Only the in-tree 32-bit
+// kernels carry the sections.
+#[cfg(all(feature = "ramfunc", feature = "tcm"))]
+compile_error!("features \"ramfunc\" and \"tcm\" are mutually exclusive");
+#[cfg(all(any(feature = "ramfunc", feature = "tcm"), not(any(feature = "interleaved", feature = "lowram"))))]
+compile_error!("features \"ramfunc\" / \"tcm\" need the \"interleaved\" or \"lowram\" kernel");
+
+#[cfg(any(feature = "interleaved", feature = "dispatch", feature = "scalar", feature = "lowram"))]
+use backend::{sha3_256, Sha3_256Context};
+#[cfg(not(any(feature = "interleaved", feature = "dispatch", feature = "scalar", feature = "lowram")))]
+#[allow(unused_imports)]
+use nano_sha3_256::{sha3_256, Sha3_256Context};
+
+/// Storage for the hash state; "counters" builds keep their tally after it
+const STATE_BYTES: usize = 352;
+
+/// Must match NANO_SHA3_256_CTX_SIZE in nano_sha3_256.h (400 with NANO_SHA3_256_COUNTERS)
+pub const NANO_SHA3_256_CTX_SIZE: usize = STATE_BYTES + counters::TALLY_SIZE;
+
+/// Caller-allocated storage for a Sha3_256Context (nano_sha3_256_ctx in C)
+#[repr(C, align(8))]
+pub struct NanoSha3_256Ctx {
+    opaque: [u64; NANO_SHA3_256_CTX_SIZE / 8],
+}
+
+// The C header hard-codes the context size, fail the build if it no longer fits
+const _: () = assert!(size_of::<Sha3_256Context>() <= STATE_BYTES);
+const _: () = assert!(NANO_SHA3_256_CTX_SIZE == 352 || NANO_SHA3_256_CTX_SIZE == 400);
+const _: () = assert!(align_of::<Sha3_256Context>() <= align_of::<NanoSha3_256Ctx>());
+
+/// Wipe the hash state after final (the counters tally stays readable)
+#[inline(always)]
+unsafe fn wipe_state(ctx: *mut NanoSha3_256Ctx) {
+    ptr::write_bytes(ctx as *mut u8, 0, STATE_BYTES);
+}
+
+#[inline(always)]
+fn as_context(ctx: *mut NanoSha3_256Ctx) -> *mut Sha3_256Context {
+    ctx as *mut Sha3_256Context
+}
+
+/// Build a byte slice from a C pointer, tolerating NULL for empty input
+#[inline(always)]
+unsafe fn input_slice<'a>(input: *const u8, len: usize) -> &'a [u8] {
+    if len == 0 {
+        &[]
+    } else {
+        slice::from_raw_parts(input, len)
+    }
+}
+
+// The core crate exports the one-shot itself, libraries without it must provide it
+#[cfg(any(feature = "interleaved", feature = "dispatch", feature = "scalar", feature = "lowram"))]
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256(out: *mut u8, input: *const u8, len: usize) {
+    let t = counters::start();
+    let hash = sha3_256(input_slice(input, len));
+    ptr::copy_nonoverlapping(hash.as_ptr(), out, hash.len());
+    counters::message(0, len, t);
+}
+
+/// Select the intel_x64 / aarch64 permutation (NANO_SHA3_256_KERNEL_* in nano_sha3_256.h)
+#[cfg(feature = "dispatch")]
+#[no_mangle]
+pub extern "C" fn nano_sha3_256_set_kernel(kernel: i32) -> i32 {
+    if kernel >= 0 && dispatch::set_kernel(kernel as u32) {
+        0
+    } else {
+        -1
+    }
+}
+
+/// Permutation the intel_x64 / aarch64 library is using
+#[cfg(feature = "dispatch")]
+#[no_mangle]
+pub extern "C" fn nano_sha3_256_get_kernel() -> i32 {
+    dispatch::active_kernel() as i32
+}
+
+// Every entry point that takes a context (or a DMA stream holding one) is
+// exported as nano_sha3_256_*_counters by "counters" builds, whose contexts
+// are 48 bytes larger; nano_sha3_256.h maps to those names under
+// NANO_SHA3_256_COUNTERS, so a header/library mismatch fails to link.
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_init_counters")]
+pub unsafe extern "C" fn nano_sha3_256_init(ctx: *mut NanoSha3_256Ctx) {
+    ptr::write(as_context(ctx), Sha3_256Context::new());
+    counters::reset(ctx);
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_update_counters")]
+pub unsafe extern "C" fn nano_sha3_256_update(ctx: *mut NanoSha3_256Ctx, input: *const u8, len: usize) {
+    let t = counters::start();
+    (*as_context(ctx)).update(input_slice(input, len));
+    counters::absorb(ctx, len, t);
+}
+
+/// nano_sha3_256_update_step status codes (must match nano_sha3_256.h)
+pub const NANO_SHA3_256_DONE: i32 = 0;
+pub const NANO_SHA3_256_MORE: i32 = 1;
+
+/// Largest chunk a single step absorbs: the SHA3-256 rate
+const STEP_BYTES: usize = 136;
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_update_step_counters")]
+pub unsafe extern "C" fn nano_sha3_256_update_step(
+    ctx: *mut NanoSha3_256Ctx,
+    input: *const u8,
+    len: usize,
+    consumed: *mut usize,
+) -> i32 {
+    // Pending + at most one rate of new bytes completes at most one block,
+    // so this call runs at most one permutation. The split depends on len only.
+    let n = if len < STEP_BYTES { len } else { STEP_BYTES };
+    let t = counters::start();
+    (*as_context(ctx)).update(input_slice(input, n));
+    counters::absorb(ctx, n, t);
+    *consumed = n;
+
+    if n < len {
+        NANO_SHA3_256_MORE
+    } else {
+        NANO_SHA3_256_DONE
+    }
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_final_counters")]
+pub unsafe extern "C" fn nano_sha3_256_final(ctx: *mut NanoSha3_256Ctx, out: *mut u8) {
+    let t = counters::start();
+
+    // lowram: squeeze straight out of the caller's storage, no stack copy
+    #[cfg(feature = "lowram")]
+    {
+        (*as_context(ctx)).finalize_into(&mut *(out as *mut [u8; 32]));
+        wipe_state(ctx);
+    }
+
+    // Move the context out so finalize() consumes it, then wipe the storage
+    #[cfg(not(feature = "lowram"))]
+    {
+        let hash = ptr::read(as_context(ctx)).finalize();
+        wipe_state(ctx);
+        ptr::copy_nonoverlapping(hash.as_ptr(), out, hash.len());
+    }
+
+    counters::finish(ctx, t);
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_clone_counters")]
+pub unsafe extern "C" fn nano_sha3_256_clone(dst: *mut NanoSha3_256Ctx, src: *const NanoSha3_256Ctx) {
+    // Plain data: copy the live context only, not the whole opaque storage
+    if dst as *const NanoSha3_256Ctx != src {
+        ptr::copy_nonoverlapping(src as *const Sha3_256Context, as_context(dst), 1);
+        counters::copy(dst, src);
+    }
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_prefix_counters")]
+pub unsafe extern "C" fn nano_sha3_256_prefix(midstate: *mut NanoSha3_256Ctx, prefix: *const u8, len: usize) {
+    let t = counters::start();
+    ptr::write(as_context(midstate), Sha3_256Context::new());
+    counters::reset(midstate);
+    (*as_context(midstate)).update(input_slice(prefix, len));
+    counters::absorb(midstate, len, t);
+}
+
+#[cfg_attr(not(feature = "counters"), no_mangle)]
+#[cfg_attr(feature = "counters", export_name = "nano_sha3_256_from_midstate_counters")]
+pub unsafe extern "C" fn nano_sha3_256_from_midstate(
+    out: *mut u8,
+    midstate: *const NanoSha3_256Ctx,
+    input: *const u8,
+    len: usize,
+) {
+    // Work on a copy so the midstate serves the next message unchanged
+    let t = counters::start();
+    let mut ctx = ptr::read(midstate as *const Sha3_256Context);
+    ctx.update(input_slice(input, len));
+    let hash = ctx.finalize();
+    ptr::copy_nonoverlapping(hash.as_ptr(), out, hash.len());
+    counters::message(counters::pending(midstate), len, t);
+}
+
+/// One scatter-gather fragment (struct nano_sha3_iov in C)
+#[repr(C)]
+pub struct NanoSha3Iov {
+    base: *const u8,
+    len: usize,
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_v(out: *mut u8, iov: *const NanoSha3Iov, n: usize) {
+    // One context across all fragments carries the block boundary over them
+    let t = counters::start();
+    let mut ctx = Sha3_256Context::new();
+    let mut total = 0;
+    if n != 0 {
+        for fragment in slice::from_raw_parts(iov, n) {
+            ctx.update(input_slice(fragment.base, fragment.len));
+            total += fragment.len;
+        }
+    }
+    let hash = ctx.finalize();
+    ptr::copy_nonoverlapping(hash.as_ptr(), out, hash.len());
+    counters::message(0, total, t);
+}
@@ -0,0 +1,274 @@
+// Multi-buffer Keccak sponge (SHA3-256, SHAKE256 leaves of ParallelHash256,
+// Merkle node levels, 4-way SHAKE absorb-once / squeeze-blocks)
+// Hashes N independent messages with one lane-parallel permutation.
+// Lanes with shorter messages finish early and idle until the longest
+// message is done, so batches of similar lengths use the kernel best.
+
+use core::ptr;
+use core::slice;
+
+use super::keccak::{keccak_f1600, Lanes, RATE, RATE_WORDS};
+use super::node64::{node64_at, NODE64_PAD_LANE16, NODE64_PAD_LANE8};
+
+/// SHA3-256 of `input[i][..len[i]]` into `out[i]` for every lane i
+///
+/// `V` must hold exactly N words. Zero-length lanes may pass NULL input.
+#[inline(always)]
+pub unsafe fn sha3_256_lanes<V: Lanes, const N: usize>(
+    out: &[*mut u8; N],
+    input: &[*const u8; N],
+    len: &[usize; N],
+) {
+    keccak_lanes::<V, N>(out, input, len, 0x06, 32)
+}
+
+/// Rate-136 sponge (capacity 512) on every lane: `domain` is the padding
+/// byte (0x06 SHA3-256, 0x1F SHAKE256), `out_len` bytes are squeezed into
+/// each `out[i]` from a single block, so `out_len <= RATE`
+#[inline(always)]
+pub unsafe fn keccak_lanes<V: Lanes, const N: usize>(
+    out: &[*mut u8; N],
+    input: &[*const u8; N],
+    len: &[usize; N],
+    domain: u8,
+    out_len: usize,
+) {
+    let mut state = [V::zero(); 25];
+    let mut offset = [0usize; N];
+    let mut done = [false; N];
+    // Padded final block for each lane, built once the lane runs short
+    let mut tail = [[0u8; RATE]; N];
+
+    loop {
+        let mut words = [[0u64; N]; RATE_WORDS];
+        let mut finishing = [false; N];
+        let mut active = false;
+
+        for l in 0..N {
+            if done[l] {
+                continue;
+            }
+            active = true;
+
+            let remaining = len[l] - offset[l];
+            let block = if remaining >= RATE {
+                let p = input[l].add(offset[l]);
+                offset[l] += RATE;
+                p
+            } else {
+                // Domain byte after the message, 0x80 on the last rate byte
+                if remaining > 0 {
+                    ptr::copy_nonoverlapping(input[l].add(offset[l]), tail[l].as_mut_ptr(), remaining);
+                }
+                tail[l][remaining] ^= domain;
+                tail[l][RATE - 1] ^= 0x80;
+                finishing[l] = true;
+                tail[l].as_ptr()
+            };
+
+            for w in 0..RATE_WORDS {
+                words[w][l] = u64::from_le(ptr::read_unaligned(block.add(8 * w) as *const u64));
+            }
+        }
+
+        if !active {
+            break;
+        }
+
+        for w in 0..RATE_WORDS {
+            state[w] = V::xor(state[w], V::load(words[w].as_ptr()));
+        }
+        keccak_f1600(&mut state);
+
+        if finishing.iter().any(|&f| f) {
+            // Squeeze the digest of every lane that just finished
+            let mut digest = [[0u64; N]; RATE_WORDS];
+            for w in 0..(out_len + 7) / 8 {
+                state[w].store(digest[w].as_mut_ptr());
+            }
+            for l in 0..N {
+                if finishing[l] {
+                    for w in 0..(out_len + 7) / 8 {
+                        let bytes = digest[w][l].to_le_bytes();
+                        let n = core::cmp::min(8, out_len - 8 * w);
+                        ptr::copy_nonoverlapping(bytes.as_ptr(), out[l].add(8 * w), n);
+                    }
+                    done[l] = true;
+                }
+            }
+        }
+    }
+
+    // Message tails may hold caller data, do not leave them on the stack
+    for t in tail.iter_mut() {
+        ptr::write_volatile(t, [0u8; RATE]);
+    }
+}
+
+/// One message at a time through the single-state path (CPUs without the SIMD kernel)
+pub unsafe fn sha3_256_scalar(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    for i in 0..out.len() {
+        let data = if len[i] == 0 { &[][..] } else { slice::from_raw_parts(input[i], len[i]) };
+        let hash = super::sha3_256(data);
+        ptr::copy_nonoverlapping(hash.as_ptr(), out[i], hash.len());
+    }
+}
+
+/// keccak_lanes over any number of messages, N at a time
+/// The last batch is filled up with empty dummy lanes.
+#[inline(always)]
+pub unsafe fn keccak_batches<V: Lanes, const N: usize>(
+    out: &[*mut u8],
+    input: &[*const u8],
+    len: &[usize],
+    domain: u8,
+    out_len: usize,
+) {
+    let mut scratch = [[0u8; RATE]; N];
+    for first in (0..out.len()).step_by(N) {
+        let mut o = [ptr::null_mut(); N];
+        let mut i = [ptr::null(); N];
+        let mut l = [0usize; N];
+        for lane in 0..N {
+            if first + lane < out.len() {
+                o[lane] = out[first + lane];
+                i[lane] = input[first + lane];
+                l[lane] = len[first + lane];
+            } else {
+                o[lane] = scratch[lane].as_mut_ptr();
+            }
+        }
+        keccak_lanes::<V, N>(&o, &i, &l, domain, out_len);
+    }
+}
+
+/// Four SHAKE states side by side (nano_shake_x4_ctx): word w of lane l at [w][l]
+/// Kept as plain lanes between calls so every kernel width (4, 2 x 2, 4 x 1)
+/// runs on the same context.
+pub type XofX4 = [[u64; 4]; 25];
+
+/// XOR one R-byte block per lane (`block[l]`, any alignment) into `state`
+#[inline(always)]
+unsafe fn xor_blocks<V: Lanes, const N: usize, const R: usize>(state: &mut [V; 25], block: &[*const u8; N]) {
+    for w in 0..R / 8 {
+        let mut words = [0u64; N];
+        for l in 0..N {
+            words[l] = u64::from_le(ptr::read_unaligned(block[l].add(8 * w) as *const u64));
+        }
+        state[w] = V::xor(state[w], V::load(words.as_ptr()));
+    }
+}
+
+/// Absorb-once of `len` bytes from each of the four inputs at rate R
+/// The states start from zero and take every full block, then the SHAKE
+/// padded tail; its permutation is left to the first squeeze, so no block
+/// is ever permuted twice. Lanes go through the kernel N at a time.
+#[inline(always)]
+pub unsafe fn xof_absorb_x4<V: Lanes, const N: usize, const R: usize>(
+    xof: &mut XofX4,
+    input: &[*const u8; 4],
+    len: usize,
+) {
+    let full = len - len % R;
+    let mut tail = [[0u8; R]; 4];
+    for l in 0..4 {
+        if len > full {
+            ptr::copy_nonoverlapping(input[l].add(full), tail[l].as_mut_ptr(), len - full);
+        }
+        tail[l][len - full] ^= 0x1F;
+        tail[l][R - 1] ^= 0x80;
+    }
+
+    for first in (0..4).step_by(N) {
+        let mut state = [V::zero(); 25];
+        let mut block = [ptr::null(); N];
+        for offset in (0..full).step_by(R) {
+            for l in 0..N {
+                block[l] = input[first + l].add(offset);
+            }
+            xor_blocks::<V, N, R>(&mut state, &block);
+            keccak_f1600(&mut state);
+        }
+        for l in 0..N {
+            block[l] = tail[first + l].as_ptr();
+        }
+        xor_blocks::<V, N, R>(&mut state, &block);
+
+        for w in 0..25 {
+            state[w].store(xof[w][first..].as_mut_ptr());
+        }
+    }
+
+    // Message tails may hold caller data, do not leave them on the stack
+    for t in tail.iter_mut() {
+        ptr::write_volatile(t, [0u8; R]);
+    }
+}
+
+/// The next `blocks` R-byte output blocks of every lane, block b of lane l
+/// to `out[l] + R * b`: one lane-parallel permutation per block
+#[inline(always)]
+pub unsafe fn xof_squeeze_x4<V: Lanes, const N: usize, const R: usize>(
+    xof: &mut XofX4,
+    out: &[*mut u8; 4],
+    blocks: usize,
+) {
+    for first in (0..4).step_by(N) {
+        let mut state = [V::zero(); 25];
+        for w in 0..25 {
+            state[w] = V::load(xof[w][first..].as_ptr());
+        }
+        for b in 0..blocks {
+            keccak_f1600(&mut state);
+            for w in 0..R / 8 {
+                let mut words = [0u64; N];
+                state[w].store(words.as_mut_ptr());
+                for l in 0..N {
+                    ptr::write_unaligned(out[first + l].add(R * b + 8 * w) as *mut u64, words[l].to_le());
+                }
+            }
+        }
+        for w in 0..25 {
+            state[w].store(xof[w][first..].as_mut_ptr());
+        }
+    }
+}
+
+/// Merkle node kernel on every lane: nodes `first..first + N` of a level
+/// (64 bytes each at `input`) into their 32-byte digests at `out`
+/// All N nodes are loaded before any digest is stored, so `out == input`
+/// (reducing a level in place) is allowed.
+#[inline(always)]
+unsafe fn node64_lanes<V: Lanes, const N: usize>(out: *mut u8, input: *const u8, first: usize) {
+    let mut state = [V::zero(); 25];
+    for w in 0..8 {
+        let mut words = [0u64; N];
+        for l in 0..N {
+            words[l] = u64::from_le(ptr::read_unaligned(input.add(64 * (first + l) + 8 * w) as *const u64));
+        }
+        state[w] = V::load(words.as_ptr());
+    }
+    state[8] = V::splat(NODE64_PAD_LANE8);
+    state[16] = V::splat(NODE64_PAD_LANE16);
+    keccak_f1600(&mut state);
+
+    for w in 0..4 {
+        let mut words = [0u64; N];
+        state[w].store(words.as_mut_ptr());
+        for l in 0..N {
+            ptr::write_unaligned(out.add(32 * (first + l) + 8 * w) as *mut u64, words[l].to_le());
+        }
+    }
+}
+
+/// A whole Merkle level, N nodes per permutation, the last count % N singly
+#[inline(always)]
+pub unsafe fn node64_level<V: Lanes, const N: usize>(out: *mut u8, input: *const u8, count: usize) {
+    let full = count - count % N;
+    for first in (0..full).step_by(N) {
+        node64_lanes::<V, N>(out, input, first);
+    }
+    for i in full..count {
+        node64_at(out, input, i);
+    }
+}
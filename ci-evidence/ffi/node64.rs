@@ -0,0 +1,87 @@
+// Fixed-length Merkle node kernel: SHA3-256 of exactly 64 bytes (left || right)
+// A 64-byte message always fits one rate block, so the state is built
+// directly: input lanes 0-7, the 0x06 domain byte in lane 8 and the final
+// 0x80 in lane 16, then a single permutation. No length loop, no block
+// buffer, no padding logic.
+
+use core::ptr;
+
+use super::counters;
+
+/// Lane 8 after padding: 0x06 on message byte 64
+pub const NODE64_PAD_LANE8: u64 = 0x06;
+
+/// Lane 16 after padding: 0x80 on the last rate byte (135)
+pub const NODE64_PAD_LANE16: u64 = 0x80 << 56;
+
+#[cfg(feature = "interleaved")]
+use super::interleaved::sha3_256_node64;
+
+#[cfg(not(feature = "interleaved"))]
+use super::sponge::permute_state;
+
+/// SHA3-256 of one 64-byte node
+#[cfg(not(feature = "interleaved"))]
+pub fn sha3_256_node64(input: &[u8; 64]) -> [u8; 32] {
+    let mut state = [0u64; 25];
+    for (lane, word) in state.iter_mut().zip(input.chunks_exact(8)) {
+        let mut bytes = [0u8; 8];
+        bytes.copy_from_slice(word);
+        *lane = u64::from_le_bytes(bytes);
+    }
+    state[8] = NODE64_PAD_LANE8;
+    state[16] = NODE64_PAD_LANE16;
+    permute_state(&mut state);
+
+    let mut out = [0u8; 32];
+    for i in 0..4 {
+        out[8 * i..8 * i + 8].copy_from_slice(&state[i].to_le_bytes());
+    }
+    out
+}
+
+/// Node `i` of a level: 64 bytes at `input + 64 * i` into `out + 32 * i`
+/// Reads the node before writing its digest, so `out == input` is allowed.
+#[inline(always)]
+pub unsafe fn node64_at(out: *mut u8, input: *const u8, i: usize) {
+    let node = ptr::read_unaligned(input.add(64 * i) as *const [u8; 64]);
+    let hash = sha3_256_node64(&node);
+    ptr::copy_nonoverlapping(hash.as_ptr(), out.add(32 * i), 32);
+}
+
+// Whole levels run N nodes per permutation call on the Linux multi-buffer kernels
+#[cfg(target_arch = "x86_64")]
+use super::x86::node64_many;
+#[cfg(target_arch = "aarch64")]
+use super::aarch64::node64_many;
+#[cfg(all(target_arch = "arm", target_os = "linux"))]
+use super::armv7::node64_many;
+// and 4 per call on the Helium library
+#[cfg(all(feature = "helium", target_arch = "arm", target_os = "none"))]
+use super::helium::node64_many;
+
+#[cfg(not(any(
+    target_arch = "x86_64",
+    target_arch = "aarch64",
+    all(target_arch = "arm", target_os = "linux"),
+    all(feature = "helium", target_arch = "arm", target_os = "none")
+)))]
+unsafe fn node64_many(out: *mut u8, input: *const u8, count: usize) {
+    for i in 0..count {
+        node64_at(out, input, i);
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_node64(out: *mut u8, input: *const u8) {
+    let t = counters::start();
+    node64_at(out, input, 0);
+    counters::nodes(1, t);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_node64_many(out: *mut u8, input: *const u8, count: usize) {
+    let t = counters::start();
+    node64_many(out, input, count);
+    counters::nodes(count, t);
+}
@@ -0,0 +1,162 @@
+// ParallelHash256 (NIST SP 800-185) for the Linux libraries
+// Leaves are SHAKE256 with a 512-bit output, hashed several at a time on
+// the multi-buffer kernel. The worker threads are spawned once per call;
+// each claims the next task of LEAVES_PER_TASK leaves, hashes it into a
+// digest window on its own stack, then waits for the task's turn to absorb
+// the window into the final cSHAKE256, so digests go in leaf order and
+// memory stays bounded for any input size. Nothing is allocated apart from
+// spawning the threads; if a spawn fails the threads already running (at
+// least the caller's) take the remaining tasks.
+
+use core::cmp::min;
+use core::ptr;
+use core::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Condvar, Mutex, MutexGuard};
+use std::thread;
+
+use super::sponge::{cshake256, left_encode, right_encode, Sponge};
+use super::input_slice;
+
+#[cfg(target_arch = "x86_64")]
+use super::x86::shake256_512_many;
+#[cfg(target_arch = "aarch64")]
+use super::aarch64::shake256_512_many;
+#[cfg(all(target_arch = "arm", target_os = "linux"))]
+use super::armv7::shake256_512_many;
+
+/// Leaf digest size: cSHAKE256(X[i], 512, "", "")
+const LEAF_DIGEST: usize = 64;
+
+/// Leaves per task (one digest window, 16 KiB of worker stack)
+const LEAVES_PER_TASK: usize = 256;
+
+/// Most worker threads per call
+const MAX_THREADS: usize = 256;
+
+/// Hash leaves `first..first + out.len()` (leaf i is x[i*b..][..b])
+fn hash_leaves(out: &mut [[u8; LEAF_DIGEST]], x: &[u8], b: usize, first: usize) {
+    let mut o = [ptr::null_mut(); LEAVES_PER_TASK];
+    let mut i = [ptr::null(); LEAVES_PER_TASK];
+    let mut l = [0usize; LEAVES_PER_TASK];
+    for (k, digest) in out.iter_mut().enumerate() {
+        let start = (first + k) * b;
+        o[k] = digest.as_mut_ptr();
+        i[k] = x[start..].as_ptr();
+        l[k] = min(b, x.len() - start);
+    }
+    let n = out.len();
+    unsafe { shake256_512_many(&o[..n], &i[..n], &l[..n]) };
+}
+
+/// The final cSHAKE256 and the task whose window it takes next
+struct Absorber {
+    sponge: Sponge<136>,
+    turn: usize,
+}
+
+/// Tasks shared by the workers of one call
+struct Tasks<'a> {
+    x: &'a [u8],
+    b: usize,
+    leaves: usize,
+    next: AtomicUsize,
+    absorber: Mutex<Absorber>,
+    turn_done: Condvar,
+}
+
+impl Tasks<'_> {
+    fn lock(&self) -> MutexGuard<'_, Absorber> {
+        // Nothing below panics while holding the lock, but never give up the hash
+        self.absorber.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    /// Claim, hash and absorb tasks until none are left
+    fn work(&self) {
+        let mut digests = [[0u8; LEAF_DIGEST]; LEAVES_PER_TASK];
+        loop {
+            let task = self.next.fetch_add(1, Ordering::Relaxed);
+            if task >= (self.leaves + LEAVES_PER_TASK - 1) / LEAVES_PER_TASK {
+                return;
+            }
+            let first = task * LEAVES_PER_TASK;
+            let batch = &mut digests[..min(LEAVES_PER_TASK, self.leaves - first)];
+            hash_leaves(batch, self.x, self.b, first);
+
+            // Tasks are claimed in order and each claimer finishes its own,
+            // so every turn comes
+            let mut absorber = self.lock();
+            while absorber.turn != task {
+                absorber = self.turn_done.wait(absorber).unwrap_or_else(|e| e.into_inner());
+            }
+            for digest in batch.iter() {
+                absorber.sponge.absorb(digest);
+            }
+            absorber.turn += 1;
+            drop(absorber);
+            self.turn_done.notify_all();
+        }
+    }
+}
+
+/// ParallelHash256(X, L = 8 * out.len(), S) with block size `b` bytes
+/// `threads` worker threads, 0 for one per available core.
+pub fn parallel_hash256(out: &mut [u8], x: &[u8], b: usize, custom: &[u8], threads: usize) {
+    // ceil(len / b) without the len + b - 1 overflow
+    let leaves = x.len() / b + (x.len() % b != 0) as usize;
+    let task_count = (leaves + LEAVES_PER_TASK - 1) / LEAVES_PER_TASK;
+    let threads = match threads {
+        0 => thread::available_parallelism().map_or(1, |n| n.get()),
+        n => n,
+    };
+    let threads = min(min(threads, MAX_THREADS), task_count);
+
+    let mut sponge = cshake256(b"ParallelHash", custom);
+    sponge.absorb(left_encode(b as u64).as_slice());
+
+    let tasks = Tasks {
+        x,
+        b,
+        leaves,
+        next: AtomicUsize::new(0),
+        absorber: Mutex::new(Absorber { sponge, turn: 0 }),
+        turn_done: Condvar::new(),
+    };
+    if threads <= 1 {
+        tasks.work();
+    } else {
+        let tasks = &tasks;
+        thread::scope(|scope| {
+            for _ in 1..threads {
+                if thread::Builder::new().spawn_scoped(scope, move || tasks.work()).is_err() {
+                    break;
+                }
+            }
+            tasks.work();
+        });
+    }
+
+    let mut sponge = tasks.absorber.into_inner().unwrap_or_else(|e| e.into_inner()).sponge;
+    sponge.absorb(right_encode(leaves as u64).as_slice());
+    sponge.absorb(right_encode(8 * out.len() as u64).as_slice());
+    sponge.finish(0x04);
+    sponge.squeeze(out);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_parallelhash256(
+    out: *mut u8,
+    out_len: usize,
+    input: *const u8,
+    len: usize,
+    block_size: usize,
+    custom: *const u8,
+    custom_len: usize,
+    threads: usize,
+) -> i32 {
+    if block_size == 0 || (out_len > 0 && out.is_null()) {
+        return -1;
+    }
+    let out = if out_len == 0 { &mut [][..] } else { core::slice::from_raw_parts_mut(out, out_len) };
+    parallel_hash256(out, input_slice(input, len), block_size, input_slice(custom, custom_len), threads);
+    0
+}
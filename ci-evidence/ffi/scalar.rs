@@ -0,0 +1,54 @@
+// Portable SHA3-256 on the lane-generic scalar permutation (cargo feature
+// "scalar"), for the unroll profile builds of verify-build-staticlibs.sh
+// The context is the SHAKE sponge at the SHA3-256 rate, so the round
+// unrolling chosen by "unroll2" / "unroll24" (ffi/keccak.rs) applies to
+// every hash the library computes.
+
+use core::ptr;
+
+use super::sponge::Sponge;
+
+/// Streaming SHA3-256 on the scalar sponge
+///
+/// Same shape as the core crate's `Sha3_256Context` so the C API in
+/// `ffi/mod.rs` wraps either one unchanged.
+pub struct Sha3_256Context {
+    sponge: Sponge<136>,
+}
+
+impl Sha3_256Context {
+    pub const fn new() -> Self {
+        Sha3_256Context { sponge: Sponge::new() }
+    }
+
+    pub fn update(&mut self, data: &[u8]) {
+        self.sponge.absorb(data);
+    }
+
+    pub fn finalize(mut self) -> [u8; 32] {
+        let mut out = [0u8; 32];
+        self.sponge.finish(0x06);
+        self.sponge.squeeze(&mut out);
+
+        // The state still holds the rest of the squeezed block
+        unsafe { ptr::write_volatile(&mut self.sponge, Sponge::new()) };
+        out
+    }
+
+    /// State and bytes absorbed into the current block (nano_sha3_256_export)
+    pub fn export(&self) -> ([u64; 25], usize) {
+        self.sponge.lanes()
+    }
+
+    /// Context continuing from an exported state (`pending` < RATE)
+    pub fn import(state: &[u64; 25], pending: usize) -> Self {
+        Sha3_256Context { sponge: Sponge::from_lanes(*state, pending) }
+    }
+}
+
+/// One-shot SHA3-256
+pub fn sha3_256(data: &[u8]) -> [u8; 32] {
+    let mut ctx = Sha3_256Context::new();
+    ctx.update(data);
+    ctx.finalize()
+}
@@ -0,0 +1,106 @@
+// SHAKE128 / SHAKE256 extendable-output functions (FIPS 202)
+// Both are the Sponge from ffi/sponge.rs at a compile-time rate (168 and
+// 136 bytes) over the same permutation. Absorb any number of times, then
+// squeeze output in any chunk sizes; the first squeeze applies the padding.
+
+use core::mem::{align_of, size_of};
+use core::ptr;
+use core::slice;
+
+use super::input_slice;
+use super::sponge::Sponge;
+
+/// SHAKE domain separation byte (0x1F: the "1111" suffix plus pad10*1)
+const SHAKE_DOMAIN: u8 = 0x1F;
+
+/// Incremental XOF over a RATE-byte sponge
+#[derive(Clone)]
+pub struct Xof<const RATE: usize> {
+    sponge: Sponge<RATE>,
+    squeezing: bool,
+}
+
+impl<const RATE: usize> Xof<RATE> {
+    pub const fn new() -> Self {
+        Xof {
+            sponge: Sponge::new(),
+            squeezing: false,
+        }
+    }
+
+    /// Absorb more input; false (input ignored) once squeezing has started
+    pub fn absorb(&mut self, data: &[u8]) -> bool {
+        if self.squeezing {
+            return false;
+        }
+        self.sponge.absorb(data);
+        true
+    }
+
+    pub fn squeeze(&mut self, out: &mut [u8]) {
+        if !self.squeezing {
+            self.sponge.finish(SHAKE_DOMAIN);
+            self.squeezing = true;
+        }
+        self.sponge.squeeze(out);
+    }
+}
+
+pub type Shake128 = Xof<168>;
+pub type Shake256 = Xof<136>;
+
+/// Must match NANO_SHAKE_CTX_SIZE in nano_sha3_256.h
+pub const NANO_SHAKE_CTX_SIZE: usize = 216;
+
+/// Caller-allocated storage for a Shake128 or Shake256 (nano_shake_ctx in C)
+#[repr(C, align(8))]
+pub struct NanoShakeCtx {
+    opaque: [u64; NANO_SHAKE_CTX_SIZE / 8],
+}
+
+const _: () = assert!(size_of::<Shake128>() <= NANO_SHAKE_CTX_SIZE);
+const _: () = assert!(size_of::<Shake256>() <= NANO_SHAKE_CTX_SIZE);
+const _: () = assert!(align_of::<Shake128>() <= align_of::<NanoShakeCtx>());
+
+#[inline(always)]
+unsafe fn output_slice<'a>(out: *mut u8, len: usize) -> &'a mut [u8] {
+    if len == 0 {
+        &mut []
+    } else {
+        slice::from_raw_parts_mut(out, len)
+    }
+}
+
+/// init / absorb / squeeze / one-shot C entry points for one rate
+macro_rules! shake_api {
+    ($xof:ty, $init:ident, $absorb:ident, $squeeze:ident, $oneshot:ident) => {
+        #[no_mangle]
+        pub unsafe extern "C" fn $init(ctx: *mut NanoShakeCtx) {
+            ptr::write(ctx as *mut $xof, <$xof>::new());
+        }
+
+        #[no_mangle]
+        pub unsafe extern "C" fn $absorb(ctx: *mut NanoShakeCtx, input: *const u8, len: usize) -> i32 {
+            if (*(ctx as *mut $xof)).absorb(input_slice(input, len)) {
+                0
+            } else {
+                -1
+            }
+        }
+
+        #[no_mangle]
+        pub unsafe extern "C" fn $squeeze(ctx: *mut NanoShakeCtx, out: *mut u8, len: usize) {
+            (*(ctx as *mut $xof)).squeeze(output_slice(out, len));
+        }
+
+        #[no_mangle]
+        pub unsafe extern "C" fn $oneshot(out: *mut u8, out_len: usize, input: *const u8, len: usize) {
+            let mut xof = <$xof>::new();
+            xof.absorb(input_slice(input, len));
+            xof.squeeze(output_slice(out, out_len));
+        }
+    };
+}
+
+shake_api!(Shake128, nano_shake128_init, nano_shake128_absorb, nano_shake128_squeeze, nano_shake128);
+shake_api!(Shake256, nano_shake256_init, nano_shake256_absorb, nano_shake256_squeeze, nano_shake256);
@@ -0,0 +1,50 @@
+// 4-way SHAKE128 / SHAKE256 for post-quantum matrix expansion (ML-KEM, ML-DSA)
+// The generators of FIPS 203 / 204 are many short SHAKE128 streams (seed plus
+// two index bytes) from which a rejection sampler pulls 168-byte blocks until
+// it has enough coefficients. Here four such streams share one context: a
+// single absorb of four equal-length inputs, then any number of whole-block
+// squeezes, each one lane-parallel permutation on the multi-buffer kernel
+// (AVX2 4-way, NEON 2 x 2-way, Helium 4-way). The sampler asks for more
+// blocks only when a lane runs short, so nothing is squeezed ahead of use.
+
+use core::mem::size_of;
+use core::ptr;
+
+use super::multibuf::XofX4;
+#[cfg(target_arch = "x86_64")]
+use super::x86::{xof_absorb_many, xof_squeeze_many};
+#[cfg(target_arch = "aarch64")]
+use super::aarch64::{xof_absorb_many, xof_squeeze_many};
+#[cfg(all(target_arch = "arm", target_os = "linux"))]
+use super::armv7::{xof_absorb_many, xof_squeeze_many};
+#[cfg(all(feature = "helium", target_arch = "arm", target_os = "none"))]
+use super::helium::{xof_absorb_many, xof_squeeze_many};
+
+/// Must match NANO_SHAKE_X4_CTX_SIZE in nano_sha3_256.h
+pub const NANO_SHAKE_X4_CTX_SIZE: usize = 800;
+
+/// Caller-allocated storage for four SHAKE states (nano_shake_x4_ctx in C)
+#[repr(C, align(8))]
+pub struct NanoShakeX4Ctx {
+    state: XofX4,
+}
+
+const _: () = assert!(size_of::<NanoShakeX4Ctx>() == NANO_SHAKE_X4_CTX_SIZE);
+
+/// absorb / squeezeblocks C entry points for one rate
+macro_rules! shake_x4_api {
+    ($rate:expr, $absorb:ident, $squeeze:ident) => {
+        #[no_mangle]
+        pub unsafe extern "C" fn $absorb(ctx: *mut NanoShakeX4Ctx, input: *const *const u8, len: usize) {
+            xof_absorb_many::<{ $rate }>(&mut (*ctx).state, &ptr::read(input as *const [*const u8; 4]), len);
+        }
+
+        #[no_mangle]
+        pub unsafe extern "C" fn $squeeze(ctx: *mut NanoShakeX4Ctx, out: *const *mut u8, blocks: usize) {
+            xof_squeeze_many::<{ $rate }>(&mut (*ctx).state, &ptr::read(out as *const [*mut u8; 4]), blocks);
+        }
+    };
+}
+
+shake_x4_api!(168, nano_shake128_x4_absorb, nano_shake128_x4_squeezeblocks);
+shake_x4_api!(136, nano_shake256_x4_absorb, nano_shake256_x4_squeezeblocks);
@@ -0,0 +1,170 @@
+// Single-state Keccak sponge with a compile-time rate and any domain byte,
+// plus the NIST SP 800-185 encodings (left_encode, right_encode, cSHAKE prefix)
+// Absorbs and squeezes byte-granular; full blocks at block boundaries are
+// XORed as whole lanes. Every rate shares one out-of-line permutation, so
+// each extra mode costs only its thin absorb/squeeze loop in flash.
+
+#[cfg(not(any(feature = "dispatch", feature = "lowram", feature = "interleaved")))]
+use super::keccak::{keccak_f1600, Word};
+
+/// intel_x64: the runtime-dispatched kernel (scalar / BMI2 / AVX-512)
+#[cfg(feature = "dispatch")]
+pub use super::dispatch::permute_state;
+
+/// cortex_m0_lowram: the in-place permutation (no second state on the stack)
+#[cfg(feature = "lowram")]
+pub use super::lowram::permute_state;
+
+/// cortex_*_fast / _ram / _asm / _mve: the bit-interleaved permutation of
+/// the SHA3-256 context, lanes converted on the way in and out
+#[cfg(feature = "interleaved")]
+pub use super::interleaved::permute_state;
+
+/// Scalar Keccak-f[1600], kept out of line so every sponge rate calls one copy
+/// The core-crate libraries (cortex_m0/m4/m33) carry it next to the core's
+/// own permutation, which the core does not expose; the sponge_permute_bytes
+/// column of build-results.csv is its flash.
+#[cfg(not(any(feature = "dispatch", feature = "lowram", feature = "interleaved")))]
+#[inline(never)]
+pub fn permute_state(a: &mut [u64; 25]) {
+    // Word is repr(transparent) over u64
+    unsafe { keccak_f1600(&mut *(a as *mut [u64; 25] as *mut [Word; 25])) }
+}
+
+/// Keccak sponge over a RATE-byte rate (168 SHAKE128, 136 SHAKE256/cSHAKE256)
+#[derive(Clone)]
+pub struct Sponge<const RATE: usize> {
+    state: [u64; 25],
+    pos: usize,
+}
+
+impl<const RATE: usize> Sponge<RATE> {
+    pub const fn new() -> Self {
+        Sponge {
+            state: [0; 25],
+            pos: 0,
+        }
+    }
+
+    /// State and position while absorbing (checkpoints of the scalar and
+    /// lowram contexts)
+    #[cfg(any(feature = "scalar", feature = "lowram"))]
+    pub fn lanes(&self) -> ([u64; 25], usize) {
+        (self.state, self.pos)
+    }
+
+    /// Sponge that continues absorbing at byte `pos` of the block
+    #[cfg(any(feature = "scalar", feature = "lowram"))]
+    pub const fn from_lanes(state: [u64; 25], pos: usize) -> Self {
+        Sponge { state, pos }
+    }
+
+    #[inline(always)]
+    fn xor_byte(&mut self, i: usize, byte: u8) {
+        self.state[i / 8] ^= (byte as u64) << (8 * (i % 8));
+    }
+
+    #[inline(always)]
+    fn permute(&mut self) {
+        permute_state(&mut self.state);
+        self.pos = 0;
+    }
+
+    pub fn absorb(&mut self, mut data: &[u8]) {
+        while !data.is_empty() {
+            if self.pos == 0 && data.len() >= RATE {
+                for (lane, word) in self.state[..RATE / 8].iter_mut().zip(data.chunks_exact(8)) {
+                    let mut bytes = [0u8; 8];
+                    bytes.copy_from_slice(word);
+                    *lane ^= u64::from_le_bytes(bytes);
+                }
+                self.permute();
+                data = &data[RATE..];
+                continue;
+            }
+
+            let take = core::cmp::min(RATE - self.pos, data.len());
+            for (i, &byte) in data[..take].iter().enumerate() {
+                self.xor_byte(self.pos + i, byte);
+            }
+            self.pos += take;
+            data = &data[take..];
+            if self.pos == RATE {
+                self.permute();
+            }
+        }
+    }
+
+    /// Zero-fill up to the next block boundary (SP 800-185 bytepad)
+    pub fn pad_block(&mut self) {
+        if self.pos != 0 {
+            self.permute();
+        }
+    }
+
+    /// Pad with `domain` (0x06 SHA3, 0x1F SHAKE, 0x04 cSHAKE) and switch to squeezing
+    pub fn finish(&mut self, domain: u8) {
+        self.xor_byte(self.pos, domain);
+        self.xor_byte(RATE - 1, 0x80);
+        self.permute();
+    }
+
+    pub fn squeeze(&mut self, out: &mut [u8]) {
+        for byte in out.iter_mut() {
+            if self.pos == RATE {
+                self.permute();
+            }
+            *byte = (self.state[self.pos / 8] >> (8 * (self.pos % 8))) as u8;
+            self.pos += 1;
+        }
+    }
+}
+
+/// SP 800-185 left_encode / right_encode output (at most 9 bytes)
+pub struct Encoded {
+    bytes: [u8; 9],
+    len: usize,
+}
+
+impl Encoded {
+    pub fn as_slice(&self) -> &[u8] {
+        &self.bytes[..self.len]
+    }
+}
+
+/// Big-endian bytes of x without leading zeros (at least one byte)
+fn be_bytes(x: u64) -> ([u8; 8], usize) {
+    let n = core::cmp::max(1, (64 - x.leading_zeros() as usize + 7) / 8);
+    (x.to_be_bytes(), n)
+}
+
+/// left_encode(x): byte count, then x big-endian
+pub fn left_encode(x: u64) -> Encoded {
+    let (be, n) = be_bytes(x);
+    let mut bytes = [0u8; 9];
+    bytes[0] = n as u8;
+    bytes[1..1 + n].copy_from_slice(&be[8 - n..]);
+    Encoded { bytes, len: n + 1 }
+}
+
+/// right_encode(x): x big-endian, then byte count
+pub fn right_encode(x: u64) -> Encoded {
+    let (be, n) = be_bytes(x);
+    let mut bytes = [0u8; 9];
+    bytes[..n].copy_from_slice(&be[8 - n..]);
+    bytes[n] = n as u8;
+    Encoded { bytes, len: n + 1 }
+}
+
+/// cSHAKE256 sponge after bytepad(encode_string(N) || encode_string(S), 136)
+/// Finish it with 0x04; with empty N and S cSHAKE256 is SHAKE256 (0x1F).
+pub fn cshake256(name: &[u8], custom: &[u8]) -> Sponge<136> {
+    let mut sponge = Sponge::<136>::new();
+    sponge.absorb(left_encode(136).as_slice());
+    sponge.absorb(left_encode(8 * name.len() as u64).as_slice());
+    sponge.absorb(name);
+    sponge.absorb(left_encode(8 * custom.len() as u64).as_slice());
+    sponge.absorb(custom);
+    sponge.pad_block();
+    sponge
+}
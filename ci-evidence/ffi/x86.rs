@@ -0,0 +1,236 @@
+// x86_64 multi-buffer kernels (intel_x64 library)
+// nano_sha3_256_x4: 4 states in AVX2 ymm registers
+// nano_sha3_256_x8: 8 states in AVX-512 zmm registers (VPROLQ + VPTERNLOGQ)
+// nano_shake128_x4_* / nano_shake256_x4_*: the AVX2 kernel on 4 SHAKE states
+// CPUs without the required extension fall back to the scalar core.
+
+use core::arch::x86_64::*;
+
+use super::keccak::{Lanes, Word};
+use super::multibuf::{
+    keccak_batches, node64_level, sha3_256_lanes, sha3_256_scalar, xof_absorb_x4, xof_squeeze_x4, XofX4,
+};
+
+#[derive(Clone, Copy)]
+struct Avx2(__m256i);
+
+impl Lanes for Avx2 {
+    #[inline(always)]
+    unsafe fn zero() -> Self {
+        Avx2(_mm256_setzero_si256())
+    }
+
+    #[inline(always)]
+    unsafe fn splat(x: u64) -> Self {
+        Avx2(_mm256_set1_epi64x(x as i64))
+    }
+
+    #[inline(always)]
+    unsafe fn load(p: *const u64) -> Self {
+        Avx2(_mm256_loadu_si256(p as *const __m256i))
+    }
+
+    #[inline(always)]
+    unsafe fn store(self, p: *mut u64) {
+        _mm256_storeu_si256(p as *mut __m256i, self.0)
+    }
+
+    #[inline(always)]
+    unsafe fn xor(a: Self, b: Self) -> Self {
+        Avx2(_mm256_xor_si256(a.0, b.0))
+    }
+
+    #[inline(always)]
+    unsafe fn rol<const L: i32, const R: i32>(a: Self) -> Self {
+        Avx2(_mm256_or_si256(_mm256_slli_epi64::<L>(a.0), _mm256_srli_epi64::<R>(a.0)))
+    }
+
+    #[inline(always)]
+    unsafe fn chi(a: Self, b: Self, c: Self) -> Self {
+        Avx2(_mm256_xor_si256(a.0, _mm256_andnot_si256(b.0, c.0)))
+    }
+}
+
+#[derive(Clone, Copy)]
+struct Avx512(__m512i);
+
+impl Lanes for Avx512 {
+    #[inline(always)]
+    unsafe fn zero() -> Self {
+        Avx512(_mm512_setzero_si512())
+    }
+
+    #[inline(always)]
+    unsafe fn splat(x: u64) -> Self {
+        Avx512(_mm512_set1_epi64(x as i64))
+    }
+
+    #[inline(always)]
+    unsafe fn load(p: *const u64) -> Self {
+        Avx512(_mm512_loadu_si512(p as *const __m512i))
+    }
+
+    #[inline(always)]
+    unsafe fn store(self, p: *mut u64) {
+        _mm512_storeu_si512(p as *mut __m512i, self.0)
+    }
+
+    #[inline(always)]
+    unsafe fn xor(a: Self, b: Self) -> Self {
+        Avx512(_mm512_xor_si512(a.0, b.0))
+    }
+
+    #[inline(always)]
+    unsafe fn rol<const L: i32, const R: i32>(a: Self) -> Self {
+        Avx512(_mm512_rol_epi64::<L>(a.0))
+    }
+
+    #[inline(always)]
+    unsafe fn chi(a: Self, b: Self, c: Self) -> Self {
+        // 0xD2: a ^ (!b & c)
+        Avx512(_mm512_ternarylogic_epi64::<0xD2>(a.0, b.0, c.0))
+    }
+
+    #[inline(always)]
+    unsafe fn xor5(a: Self, b: Self, c: Self, d: Self, e: Self) -> Self {
+        // 0x96: three-way XOR
+        let abc = _mm512_ternarylogic_epi64::<0x96>(a.0, b.0, c.0);
+        Avx512(_mm512_ternarylogic_epi64::<0x96>(abc, d.0, e.0))
+    }
+}
+
+#[target_feature(enable = "avx2")]
+unsafe fn sha3_256_x4_avx2(out: &[*mut u8; 4], input: &[*const u8; 4], len: &[usize; 4]) {
+    sha3_256_lanes::<Avx2, 4>(out, input, len)
+}
+
+#[target_feature(enable = "avx512f")]
+unsafe fn sha3_256_x8_avx512(out: &[*mut u8; 8], input: &[*const u8; 8], len: &[usize; 8]) {
+    sha3_256_lanes::<Avx512, 8>(out, input, len)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_x4(out: *const *mut u8, input: *const *const u8, len: *const usize) {
+    let out = &*(out as *const [*mut u8; 4]);
+    let input = &*(input as *const [*const u8; 4]);
+    let len = &*(len as *const [usize; 4]);
+
+    if std::is_x86_feature_detected!("avx2") {
+        sha3_256_x4_avx2(out, input, len);
+    } else {
+        sha3_256_scalar(out, input, len);
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn nano_sha3_256_x8(out: *const *mut u8, input: *const *const u8, len: *const usize) {
+    let out = &*(out as *const [*mut u8; 8]);
+    let input = &*(input as *const [*const u8; 8]);
+    let len = &*(len as *const [usize; 8]);
+
+    if std::is_x86_feature_detected!("avx512f") {
+        sha3_256_x8_avx512(out, input, len);
+    } else if std::is_x86_feature_detected!("avx2") {
+        // Two AVX2 halves
+        for h in 0..2 {
+            let o = &*(out[4 * h..].as_ptr() as *const [*mut u8; 4]);
+            let i = &*(input[4 * h..].as_ptr() as *const [*const u8; 4]);
+            let l = &*(len[4 * h..].as_ptr() as *const [usize; 4]);
+            sha3_256_x4_avx2(o, i, l);
+        }
+    } else {
+        sha3_256_scalar(out, input, len);
+    }
+}
+
+#[target_feature(enable = "avx2")]
+unsafe fn sha3_256_avx2(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Avx2, 4>(out, input, len, 0x06, 32)
+}
+
+#[target_feature(enable = "avx512f")]
+unsafe fn sha3_256_avx512(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Avx512, 8>(out, input, len, 0x06, 32)
+}
+
+/// SHA3-256 of every message, 8 or 4 per permutation (nano_sha3_256_batch)
+pub unsafe fn sha3_256_many(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    if std::is_x86_feature_detected!("avx512f") {
+        sha3_256_avx512(out, input, len);
+    } else if std::is_x86_feature_detected!("avx2") {
+        sha3_256_avx2(out, input, len);
+    } else {
+        sha3_256_scalar(out, input, len);
+    }
+}
+
+#[target_feature(enable = "avx2")]
+unsafe fn shake256_512_avx2(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Avx2, 4>(out, input, len, 0x1F, 64)
+}
+
+#[target_feature(enable = "avx512f")]
+unsafe fn shake256_512_avx512(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    keccak_batches::<Avx512, 8>(out, input, len, 0x1F, 64)
+}
+
+/// SHAKE256 with 512-bit output for every message (ParallelHash256 leaves)
+pub unsafe fn shake256_512_many(out: &[*mut u8], input: &[*const u8], len: &[usize]) {
+    if std::is_x86_feature_detected!("avx512f") {
+        shake256_512_avx512(out, input, len);
+    } else if std::is_x86_feature_detected!("avx2") {
+        shake256_512_avx2(out, input, len);
+    } else {
+        keccak_batches::<Word, 1>(out, input, len, 0x1F, 64);
+    }
+}
+
+#[target_feature(enable = "avx2")]
+unsafe fn xof_absorb_avx2<const R: usize>(xof: &mut XofX4, input: &[*const u8; 4], len: usize) {
+    xof_absorb_x4::<Avx2, 4, R>(xof, input, len)
+}
+
+#[target_feature(enable = "avx2")]
+unsafe fn xof_squeeze_avx2<const R: usize>(xof: &mut XofX4, out: &[*mut u8; 4], blocks: usize) {
+    xof_squeeze_x4::<Avx2, 4, R>(xof, out, blocks)
+}
+
+/// 4-way SHAKE absorb-once at rate R (nano_shake128_x4_absorb / _256_)
+/// AVX2 even on AVX-512 CPUs: the API is four states wide.
+pub unsafe fn xof_absorb_many<const R: usize>(xof: &mut XofX4, input: &[*const u8; 4], len: usize) {
+    if std::is_x86_feature_detected!("avx2") {
+        xof_absorb_avx2::<R>(xof, input, len);
+    } else {
+        xof_absorb_x4::<Word, 1, R>(xof, input, len);
+    }
+}
+
+/// 4-way SHAKE squeeze of whole rate blocks (nano_shake128_x4_squeezeblocks / _256_)
+pub unsafe fn xof_squeeze_many<const R: usize>(xof: &mut XofX4, out: &[*mut u8; 4], blocks: usize) {
+    if std::is_x86_feature_detected!("avx2") {
+        xof_squeeze_avx2::<R>(xof, out, blocks);
+    } else {
+        xof_squeeze_x4::<Word, 1, R>(xof, out, blocks);
+    }
+}
+
+#[target_feature(enable = "avx2")]
+unsafe fn node64_avx2(out: *mut u8, input: *const u8, count: usize) {
+    node64_level::<Avx2, 4>(out, input, count)
+}
+
+#[target_feature(enable = "avx512f")]
+unsafe fn node64_avx512(out: *mut u8, input: *const u8, count: usize) {
+    node64_level::<Avx512, 8>(out, input, count)
+}
+
+/// One Merkle level of 64-byte nodes (nano_sha3_256_node64_many)
+pub unsafe fn node64_many(out: *mut u8, input: *const u8, count: usize) {
+    if std::is_x86_feature_detected!("avx512f") {
+        node64_avx512(out, input, count);
+    } else if std::is_x86_feature_detected!("avx2") {
+        node64_avx2(out, input, count);
+    } else {
+        node64_level::<Word, 1>(out, input, count);
+    }
+}
@@ -0,0 +1,291 @@
+/*
+ * nano-sha3sum: SHA3-256 of files and pipes using the Linux static libraries
+ * Regular files are mapped one window at a time (mmap + MADV_SEQUENTIAL) and
+ * fed to the streaming API straight from the page cache. Pipes, ttys and
+ * anything mmap refuses go through two read buffers, one filled by a reader
+ * thread while the other is hashed. -j hashes that many files at once.
+ * Output is "<digest>  <name>", the sha3sum -a 256 / rhash format.
+ */
+
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "nano_sha3_256.h"
+
+// SHA3-256 rate in bytes
+#define RATE 136
+
+// Read buffer: whole rate blocks, so every chunk absorbs straight from the
+// buffer and none goes through the context's partial-block copy
+#define READ_BUFFER ((size_t)RATE * 8192)
+
+// Mapping window: a multiple of the rate and of 64 KiB pages (68 MiB), small
+// enough to map on 32-bit arm_linux whatever the file size
+#define MAP_WINDOW ((size_t)17 * 4 * 1024 * 1024)
+
+// Below this a regular file is read, mapping it costs more than it saves
+#define MMAP_MIN ((off_t)64 * 1024)
+
+typedef struct {
+    const char *name;
+    uint8_t digest[32];
+    int error;  // errno of the failure, 0 on success
+} Job;
+
+static Job *jobs;
+static size_t job_count;
+static size_t next_job;
+static pthread_mutex_t job_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Two buffers handed back and forth between the reader thread and the hasher
+typedef struct {
+    int fd;
+    uint8_t *buf[2];
+    size_t len[2];
+    int full[2];  // filled by the reader, not yet hashed
+    int error;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} Reader;
+
+// Fill up to `len` bytes, short only at end of input or on error
+static size_t read_full(int fd, uint8_t *buf, size_t len, int *error) {
+    size_t got = 0;
+    while (got < len) {
+        ssize_t n = read(fd, buf + got, len - got);
+        if (n > 0) {
+            got += (size_t)n;
+        } else if (n == 0) {
+            break;
+        } else if (errno != EINTR) {
+            *error = errno;
+            break;
+        }
+    }
+    return got;
+}
+
+static void *reader_main(void *arg) {
+    Reader *r = arg;
+    for (int slot = 0;; slot ^= 1) {
+        pthread_mutex_lock(&r->lock);
+        while (r->full[slot]) {
+            pthread_cond_wait(&r->cond, &r->lock);
+        }
+        pthread_mutex_unlock(&r->lock);
+
+        int error = 0;
+        size_t len = read_full(r->fd, r->buf[slot], READ_BUFFER, &error);
+
+        pthread_mutex_lock(&r->lock);
+        r->len[slot] = len;
+        r->full[slot] = 1;
+        if (error) {
+            r->error = error;
+        }
+        pthread_cond_signal(&r->cond);
+        pthread_mutex_unlock(&r->lock);
+
+        // A short buffer is the last one
+        if (len < READ_BUFFER) {
+            return NULL;
+        }
+    }
+}
+
+// Double-buffered reads: hash one buffer while the reader fills the other
+static int hash_stream(int fd, nano_sha3_256_ctx *ctx) {
+    Reader r;
+    memset(&r, 0, sizeof(r));
+    r.fd = fd;
+    if (posix_memalign((void **)&r.buf[0], 64, 2 * READ_BUFFER) != 0) {
+        return ENOMEM;
+    }
+    r.buf[1] = r.buf[0] + READ_BUFFER;
+    pthread_mutex_init(&r.lock, NULL);
+    pthread_cond_init(&r.cond, NULL);
+
+    pthread_t reader;
+    int error = pthread_create(&reader, NULL, reader_main, &r);
+    if (error == 0) {
+        for (int slot = 0;; slot ^= 1) {
+            pthread_mutex_lock(&r.lock);
+            while (!r.full[slot]) {
+                pthread_cond_wait(&r.cond, &r.lock);
+            }
+            size_t len = r.len[slot];
+            pthread_mutex_unlock(&r.lock);
+
+            nano_sha3_256_update(ctx, r.buf[slot], len);
+
+            pthread_mutex_lock(&r.lock);
+            r.full[slot] = 0;
+            pthread_cond_signal(&r.cond);
+            pthread_mutex_unlock(&r.lock);
+
+            if (len < READ_BUFFER) {
+                break;
+            }
+        }
+        pthread_join(reader, NULL);
+        error = r.error;
+    }
+
+    pthread_cond_destroy(&r.cond);
+    pthread_mutex_destroy(&r.lock);
+    free(r.buf[0]);
+    return error;
+}
+
+// Map and absorb `size` bytes window by window
+// Returns 0, an errno, or -1 if the first window could not be mapped
+// (nothing absorbed yet, the caller falls back to reads)
+static int hash_mapped(int fd, off_t size, nano_sha3_256_ctx *ctx) {
+    for (off_t offset = 0; offset < size; offset += (off_t)MAP_WINDOW) {
+        size_t len = size - offset < (off_t)MAP_WINDOW ? (size_t)(size - offset) : MAP_WINDOW;
+        uint8_t *map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, offset);
+        if (map == MAP_FAILED) {
+            return offset == 0 ? -1 : errno;
+        }
+        madvise(map, len, MADV_SEQUENTIAL);
+        nano_sha3_256_update(ctx, map, len);
+        munmap(map, len);
+    }
+    return 0;
+}
+
+static void hash_job(Job *job) {
+    int fd = 0;
+    if (strcmp(job->name, "-") != 0) {
+        fd = open(job->name, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            job->error = errno;
+            return;
+        }
+    }
+
+    nano_sha3_256_ctx ctx;
+    nano_sha3_256_init(&ctx);
+
+    struct stat st;
+    int error = -1;
+    if (fstat(fd, &st) != 0) {
+        error = errno;
+    } else if (S_ISDIR(st.st_mode)) {
+        error = EISDIR;
+    } else if (S_ISREG(st.st_mode) && st.st_size >= MMAP_MIN) {
+        error = hash_mapped(fd, st.st_size, &ctx);
+    }
+    if (error == -1) {
+        error = hash_stream(fd, &ctx);
+    }
+
+    if (fd != 0) {
+        close(fd);
+    }
+    job->error = error;
+    if (error == 0) {
+        nano_sha3_256_final(&ctx, job->digest);
+    }
+}
+
+static void *worker_main(void *arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&job_lock);
+        size_t i = next_job++;
+        pthread_mutex_unlock(&job_lock);
+        if (i >= job_count) {
+            return NULL;
+        }
+        hash_job(&jobs[i]);
+    }
+}
+
+static void usage(FILE *stream) {
+    fprintf(stream,
+            "Usage: nano-sha3sum [-j JOBS] [FILE]...\n"
+            "Print SHA3-256 digests. With no FILE, or when FILE is -, read standard input.\n"
+            "  -j JOBS  hash up to JOBS files at once (default: one per online CPU)\n");
+}
+
+int main(int argc, char **argv) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int opt;
+    while ((opt = getopt(argc, argv, "hj:")) != -1) {
+        if (opt == 'j') {
+            char *end;
+            threads = strtol(optarg, &end, 10);
+            if (*end != '\0' || threads < 1) {
+                fprintf(stderr, "nano-sha3sum: invalid job count '%s'\n", optarg);
+                return 2;
+            }
+        } else if (opt == 'h') {
+            usage(stdout);
+            return 0;
+        } else {
+            usage(stderr);
+            return 2;
+        }
+    }
+
+    static char *const stdin_only[] = {"-"};
+    char *const *names = optind < argc ? argv + optind : stdin_only;
+    job_count = optind < argc ? (size_t)(argc - optind) : 1;
+    jobs = calloc(job_count, sizeof(Job));
+    if (!jobs) {
+        fprintf(stderr, "nano-sha3sum: out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < job_count; i++) {
+        jobs[i].name = names[i];
+    }
+
+    if (threads < 1) {
+        threads = 1;
+    }
+    if ((size_t)threads > job_count) {
+        threads = (long)job_count;
+    }
+
+    // The calling thread is worker 0
+    pthread_t *workers = calloc((size_t)threads, sizeof(pthread_t));
+    long started = 1;
+    if (workers) {
+        while (started < threads && pthread_create(&workers[started], NULL, worker_main, NULL) == 0) {
+            started++;
+        }
+    }
+    worker_main(NULL);
+    for (long t = 1; t < started; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    free(workers);
+
+    // Results in argument order, whatever order the workers finished in
+    int status = 0;
+    for (size_t i = 0; i < job_count; i++) {
+        if (jobs[i].error) {
+            fprintf(stderr, "nano-sha3sum: %s: %s\n", jobs[i].name, strerror(jobs[i].error));
+            status = 1;
+            continue;
+        }
+        char hex[65];
+        for (int b = 0; b < 32; b++) {
+            snprintf(hex + 2 * b, 3, "%02x", jobs[i].digest[b]);
+        }
+        printf("%s  %s\n", hex, jobs[i].name);
+    }
+    free(jobs);
+    return status;
+}
@@ -11,5 +11,11 @@ int main(void) {
     unsigned char input[1] = {0};
     nano_sha3_256(output, input, sizeof(input));
     
+    // Reference the streaming API so its symbols are kept as well
+    nano_sha3_256_ctx ctx;
+    nano_sha3_256_init(&ctx);
+    nano_sha3_256_update(&ctx, input, sizeof(input));
+    nano_sha3_256_final(&ctx, output);
+    
     return 0;
 }
\ No newline at end of file
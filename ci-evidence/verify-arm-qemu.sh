@@ -27,12 +27,23 @@ EVIDENCE_FILE="${RESULTS_DIR}/arm-qemu-evidence.md"
 declare -a ARM_TARGETS=(
     "cortex_m0:microbit:thumbv6m-none-eabi:cortex-m0:cortex_m0"
     "cortex_m4:mps2-an386:thumbv7em-none-eabi:cortex-m4:cortex_m4"
+    "cortex_m4_fast:mps2-an386:thumbv7em-none-eabi:cortex-m4:cortex_m4_fast"
+    "cortex_m4_ram:mps2-an386:thumbv7em-none-eabi:cortex-m4:cortex_m4_ram"
+    "cortex_m0_lowram:microbit:thumbv6m-none-eabi:cortex-m0:cortex_m0_lowram"
+    "cortex_m0_asm:microbit:thumbv6m-none-eabi:cortex-m0:cortex_m0_asm"
     # "cortex_m33:mps2-an505:thumbv8m.main-none-eabi:cortex-m33:cortex_m33"  # Disabled - QEMU 6.2 incompatible
+    # "cortex_m33_fast:mps2-an505:thumbv8m.main-none-eabi:cortex-m33:cortex_m33_fast"  # Disabled - QEMU 6.2 incompatible
+    # "cortex_m55_mve:mps3-an547:thumbv8m.main-none-eabihf:cortex-m55:cortex_m55_mve"  # Disabled - QEMU 6.2 incompatible (ARMv8-M)
 )
 
 # Test timeout in seconds
 QEMU_TIMEOUT=30
 
+# QEMU does not model DWT->CYCCNT; with -icount shift=0 the virtual clock
+# advances 1 ns per retired instruction, so SysTick (and the harness's
+# cycle benchmark) is deterministic and proportional to instructions
+QEMU_ICOUNT="shift=0"
+
 # Logging functions
 log_info() {
     echo -e "${GREEN}[INFO]${NC} $1"
@@ -82,6 +93,20 @@ check_dependencies() {
     log_info "✓ All QEMU validation tools available"
 }
 
+# Locate the static library to link for an ARM target
+# Prefers the C API library (one-shot + streaming) over the core crate archive
+find_arm_library() {
+    local build_subdir=$1
+    local rust_target=$2
+    local release_dir="${BUILD_DIR}/${build_subdir}/target/${rust_target}/release"
+    
+    if [[ -f "${release_dir}/libnano_sha3_256_capi.a" ]]; then
+        echo "${release_dir}/libnano_sha3_256_capi.a"
+    else
+        find "${release_dir}" -name "libnano_sha3_256*.a" 2>/dev/null | head -1
+    fi
+}
+
 # Check if ARM static libraries exist
 check_arm_libraries() {
     log_info "Checking for ARM static libraries..."
@@ -100,7 +125,7 @@ check_arm_libraries() {
         total_libs=$((total_libs + 1))
         
         # Find the actual static library in the build directory
-        local lib_path=$(find "${BUILD_DIR}/${build_subdir}/target/${rust_target}/release" -name "libnano_sha3_256*.a" | head -1)
+        local lib_path=$(find_arm_library "${build_subdir}" "${rust_target}")
         
         if [[ -f "${lib_path}" ]]; then
             found_libs=$((found_libs + 1))
@@ -118,6 +143,52 @@ check_arm_libraries() {
     log_info "Found ${found_libs}/${total_libs} ARM static libraries"
 }
 
+# Embed NIST vectors for the DMA ping-pong test: all of ShortMsg plus the
+# first QEMU_LONG_VECTORS of LongMsg (keeps the image within 256K flash)
+QEMU_LONG_VECTORS=16
+
+create_nist_vectors() {
+    local test_dir=$1
+    local header="${test_dir}/nist_vectors.h"
+    local data_dir="${PROJECT_ROOT}/ci-evidence/test_data_nist"
+    
+    awk -v long_max="${QEMU_LONG_VECTORS}" '
+        FNR == 1 { file++; taken = 0 }
+        /^Len = / { len = $3 / 8 }
+        /^Msg = / { msg = $3 }
+        /^MD = / {
+            if (file == 2 && taken >= long_max) next
+            taken++
+            table[count++] = sprintf("    {%d, %d, {%s}},", offset, len, bytes($3, 32))
+            if (len > 0) blob = blob (blob == "" ? "" : ",\n     ") bytes(msg, len)
+            offset += len
+        }
+        function bytes(hex, n,    i, out) {
+            out = ""
+            for (i = 0; i < n; i++) {
+                out = out (i ? (i % 16 ? ", " : ",\n     ") : "") "0x" substr(hex, 2 * i + 1, 2)
+            }
+            return out
+        }
+        END {
+            print "// Generated by verify-arm-qemu.sh from test_data_nist (do not edit)"
+            print "static const uint8_t nist_msgs[] = {"
+            print "     " blob
+            print "};"
+            print "static const struct {"
+            print "    uint32_t offset;"
+            print "    uint32_t len;"
+            print "    uint8_t md[32];"
+            print "} nist_vectors[] = {"
+            for (i = 0; i < count; i++) print table[i]
+            print "};"
+            print "#define NIST_VECTOR_COUNT (sizeof(nist_vectors) / sizeof(nist_vectors[0]))"
+        }
+    ' "${data_dir}/SHA3_256ShortMsg.rsp" "${data_dir}/SHA3_256LongMsg.rsp" > "${header}"
+    
+    echo "${header}"
+}
+
 # Create test harness C code
 create_test_harness() {
     local test_dir=$1
@@ -129,8 +200,8 @@ create_test_harness() {
 #include <stdint.h>
 #include <stddef.h>
 
-// External function from static library
-extern void nano_sha3_256(uint8_t output[32], const uint8_t *input, size_t len);
+#include "nano_sha3_256.h"
+#include "nist_vectors.h"
 
 // QEMU semihosting support
 void _exit(int status) __attribute__((noreturn));
@@ -159,9 +230,253 @@ void print_hex_byte(uint8_t val) {
     _write_string(hex);
 }
 
+// DMA half-buffer sizes: one rate, unaligned, two rates (block-aligned hand-off)
+static const uint32_t dma_halves[] = {136, 200, 272};
+
+// Ping-pong buffer and state live in .bss, clear of the 2 KiB stack
+static uint8_t dma_buf[2 * 272] __attribute__((aligned(8)));
+static nano_sha3_256_dma dma;
+
+// Stand-in for the peripheral: the DMA engine writing one half
+static void dma_transfer(uint8_t *dst, const uint8_t *src, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+        dst[i] = src[i];
+    }
+}
+
+// Every embedded NIST vector in DMA-sized chunks through the ping-pong API
+__attribute__((noinline)) static int test_dma(void) {
+    uint8_t digest[32];
+    for (uint32_t h = 0; h < sizeof(dma_halves) / sizeof(dma_halves[0]); h++) {
+        uint32_t half_len = dma_halves[h];
+        for (uint32_t v = 0; v < NIST_VECTOR_COUNT; v++) {
+            const uint8_t *msg = nist_msgs + nist_vectors[v].offset;
+            uint32_t len = nist_vectors[v].len;
+            uint32_t off = 0;
+            int half = 0;
+            
+            nano_sha3_256_dma_init(&dma, dma_buf, half_len);
+            while (len - off >= half_len) {
+                dma_transfer(dma_buf + half * half_len, msg + off, half_len);
+                nano_sha3_256_dma_absorb_half(&dma);
+                off += half_len;
+                half ^= 1;
+            }
+            dma_transfer(dma_buf + half * half_len, msg + off, len - off);
+            nano_sha3_256_dma_final(&dma, len - off, digest);
+            
+            for (int i = 0; i < 32; i++) {
+                if (digest[i] != nist_vectors[v].md[i]) {
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+#ifdef HAVE_CHECKPOINT
+// Every embedded NIST vector checkpointed mid-message (and on a block
+// boundary when it has one), resumed in a second context and finished
+__attribute__((noinline)) static int test_checkpoint(void) {
+    static nano_sha3_256_ctx ctx, resumed;
+    static uint8_t image[NANO_SHA3_256_EXPORT_SIZE];
+    uint8_t digest[32];
+    for (uint32_t v = 0; v < NIST_VECTOR_COUNT; v++) {
+        const uint8_t *msg = nist_msgs + nist_vectors[v].offset;
+        uint32_t len = nist_vectors[v].len;
+        uint32_t at[2] = { len / 2, len >= 136 ? 136 : len };
+        for (int s = 0; s < 2; s++) {
+            nano_sha3_256_init(&ctx);
+            nano_sha3_256_update(&ctx, msg, at[s]);
+            nano_sha3_256_export(&ctx, image);
+            if (nano_sha3_256_import(&resumed, image) != 0) {
+                return 0;
+            }
+            nano_sha3_256_update(&resumed, msg + at[s], len - at[s]);
+            nano_sha3_256_final(&resumed, digest);
+            for (int i = 0; i < 32; i++) {
+                if (digest[i] != nist_vectors[v].md[i]) {
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+#endif
+
+// Cycle benchmark: DWT->CYCCNT around each call where the core has one
+// (ARMv7-M and ARMv8-M mainline) and it advances. QEMU reads the DWT as
+// zero, so there SysTick on the processor clock is used instead; under
+// -icount it follows retired instructions, and a calibration loop of known
+// length gives the script instructions per tick. Values are printed in hex
+// (no division in the harness) as "BENCH <source> <len> <count>".
+#define DEMCR      (*(volatile uint32_t *)0xE000EDFC)
+#define DWT_CTRL   (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+#define SYST_CSR   (*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR   (*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR   (*(volatile uint32_t *)0xE000E018)
+
+// Empty, a short block, one rate, 8 and 60 rates (the input sits in flash)
+static const uint32_t bench_lens[] = {0, 64, 136, 1088, 8160};
+static const uint8_t bench_msg[8160] = {0x61};
+
+#define BENCH_SPIN 100000u
+
+static int use_dwt;
+
+// 2 * n instructions: one subs and one bne per iteration
+__attribute__((noinline)) static void spin(uint32_t n) {
+    __asm volatile (".syntax unified\n1:\n\tsubs %0, %0, #1\n\tbne 1b" : "+l"(n) : : "cc");
+}
+
+static void clock_init(void) {
+    SYST_RVR = 0x00FFFFFF;
+    SYST_CVR = 0;
+    SYST_CSR = 0x5; // processor clock, no interrupt, enabled
+#if !defined(__ARM_ARCH_6M__)
+    DEMCR |= 1u << 24; // TRCENA
+    if (!(DWT_CTRL & (1u << 25))) { // NOCYCCNT clear
+        DWT_CYCCNT = 0;
+        DWT_CTRL |= 1;
+        uint32_t t = DWT_CYCCNT;
+        spin(1000);
+        use_dwt = DWT_CYCCNT != t;
+    }
+#endif
+}
+
+// Cycles (DWT, counting up) or SysTick ticks (24 bits, counting down)
+static uint32_t clock_now(void) {
+    return use_dwt ? DWT_CYCCNT : 0x00FFFFFFu - SYST_CVR;
+}
+
+static uint32_t clock_since(uint32_t t) {
+    uint32_t d = clock_now() - t;
+    return use_dwt ? d : d & 0x00FFFFFFu;
+}
+
+static void print_hex_u32(uint32_t v) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        print_hex_byte((uint8_t)(v >> shift));
+    }
+}
+
+static void report(const char *source, uint32_t len, uint32_t count) {
+    _write_string("BENCH ");
+    _write_string(source);
+    _write_string(" ");
+    print_hex_u32(len);
+    _write_string(" ");
+    print_hex_u32(count);
+    _write_string("\n");
+}
+
+__attribute__((noinline)) static void bench(void) {
+    uint8_t digest[32];
+    clock_init();
+    if (!use_dwt) {
+        uint32_t t = clock_now();
+        spin(BENCH_SPIN);
+        report("calib", 2 * BENCH_SPIN, clock_since(t));
+    }
+    for (uint32_t i = 0; i < sizeof(bench_lens) / sizeof(bench_lens[0]); i++) {
+        uint32_t t = clock_now();
+        nano_sha3_256(digest, bench_msg, bench_lens[i]);
+        report(use_dwt ? "dwt" : "systick", bench_lens[i], clock_since(t));
+    }
+}
+
+#ifdef __ARM_FEATURE_MVE
+// Every embedded NIST vector through the Helium nano_sha3_256_x4, four
+// consecutive vectors (wrapping) per call, against the one-shot
+__attribute__((noinline)) static int test_x4(void) {
+    uint8_t digests[4][32];
+    uint8_t *const out[4] = { digests[0], digests[1], digests[2], digests[3] };
+    for (uint32_t v = 0; v < NIST_VECTOR_COUNT; v++) {
+        const uint8_t *in[4];
+        size_t len[4];
+        for (uint32_t l = 0; l < 4; l++) {
+            uint32_t k = (v + l) % NIST_VECTOR_COUNT;
+            in[l] = nist_msgs + nist_vectors[k].offset;
+            len[l] = nist_vectors[k].len;
+        }
+        nano_sha3_256_x4(out, in, len);
+        for (uint32_t l = 0; l < 4; l++) {
+            uint8_t expected[32];
+            nano_sha3_256(expected, in[l], len[l]);
+            for (int i = 0; i < 32; i++) {
+                if (digests[l][i] != expected[i]) {
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+// ML-KEM style matrix expansion through the 4-way SHAKE API: four
+// seed || j || i inputs, three SHAKE128 blocks squeezed as 1 + 2 and one
+// SHAKE256 block, each lane against the one-shot
+static uint8_t x4_out[4][3 * NANO_SHAKE128_RATE];
+static uint8_t x4_expected[3 * NANO_SHAKE128_RATE];
+
+__attribute__((noinline)) static int test_shake_x4(void) {
+    uint8_t seeds[4][34];
+    const uint8_t *in[4];
+    uint8_t *out[4];
+    nano_shake_x4_ctx ctx;
+    for (uint32_t l = 0; l < 4; l++) {
+        for (uint32_t i = 0; i < 32; i++) {
+            seeds[l][i] = (uint8_t)(i * 7 + 1);
+        }
+        seeds[l][32] = (uint8_t)(l & 1);
+        seeds[l][33] = (uint8_t)(l >> 1);
+        in[l] = seeds[l];
+        out[l] = x4_out[l];
+    }
+
+    nano_shake128_x4_absorb(&ctx, in, sizeof(seeds[0]));
+    nano_shake128_x4_squeezeblocks(&ctx, out, 1);
+    for (uint32_t l = 0; l < 4; l++) {
+        out[l] = x4_out[l] + NANO_SHAKE128_RATE;
+    }
+    nano_shake128_x4_squeezeblocks(&ctx, out, 2);
+    for (uint32_t l = 0; l < 4; l++) {
+        nano_shake128(x4_expected, sizeof(x4_expected), in[l], sizeof(seeds[0]));
+        for (uint32_t i = 0; i < sizeof(x4_expected); i++) {
+            if (x4_out[l][i] != x4_expected[i]) {
+                return 0;
+            }
+        }
+        out[l] = x4_out[l];
+    }
+
+    nano_shake256_x4_absorb(&ctx, in, sizeof(seeds[0]));
+    nano_shake256_x4_squeezeblocks(&ctx, out, 1);
+    for (uint32_t l = 0; l < 4; l++) {
+        nano_shake256(x4_expected, NANO_SHAKE256_RATE, in[l], sizeof(seeds[0]));
+        for (uint32_t i = 0; i < NANO_SHAKE256_RATE; i++) {
+            if (x4_out[l][i] != x4_expected[i]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+#endif
+
 void _start() {
     uint8_t output[32];
     
+#if defined(__ARM_FP) || defined(__ARM_FEATURE_MVE)
+    // Hard-float / MVE library: enable CP10/CP11 before the first call
+    *(volatile uint32_t *)0xE000ED88 |= 0xFu << 20;
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+#endif
+
     _write_string("Starting QEMU validation tests...\n");
     
     // Test 1: Empty input (NIST test vector)
@@ -215,6 +530,192 @@ void _start() {
     
     _write_string("PASS: Large input test\n");
     
+    // Test 4: Streaming API must match one-shot on the same 200 bytes
+    uint8_t streamed[32];
+    nano_sha3_256_ctx ctx;
+    nano_sha3_256_init(&ctx);
+    nano_sha3_256_update(&ctx, large_input, 1);
+    nano_sha3_256_update(&ctx, large_input + 1, 136);
+    nano_sha3_256_update(&ctx, large_input + 137, 63);
+    nano_sha3_256_final(&ctx, streamed);
+    
+    _write_string("STREAM: ");
+    for (int i = 0; i < 4; i++) {
+        print_hex_byte(streamed[i]);
+    }
+    _write_string("\n");
+    
+    for (int i = 0; i < 32; i++) {
+        if (streamed[i] != output[i]) {
+            _write_string("FAIL: Streaming API test\n");
+            _exit(1);
+        }
+    }
+    _write_string("PASS: Streaming API test\n");
+    
+    // Test 5: Step API (one block per call) must match one-shot too
+    uint8_t stepped[32];
+    size_t off = 0;
+    int steps = 0;
+    int status;
+    nano_sha3_256_init(&ctx);
+    do {
+        size_t consumed = 0;
+        status = nano_sha3_256_update_step(&ctx, large_input + off, 200 - off, &consumed);
+        off += consumed;
+        steps++;
+    } while (status == NANO_SHA3_256_MORE);
+    nano_sha3_256_final(&ctx, stepped);
+    
+    for (int i = 0; i < 32; i++) {
+        if (stepped[i] != output[i]) {
+            _write_string("FAIL: Step API test\n");
+            _exit(1);
+        }
+    }
+    if (steps != 2) {
+        _write_string("FAIL: Step API work bound\n");
+        _exit(1);
+    }
+    _write_string("PASS: Step API test\n");
+    
+    // Test 5b: Scatter-gather list, one block straddling three fragments
+    // and an empty one, must match one-shot
+    uint8_t gathered[32];
+    const struct nano_sha3_iov frags[] = {
+        { large_input, 1 }, { large_input + 1, 100 }, { NULL, 0 },
+        { large_input + 101, 35 }, { large_input + 136, 64 },
+    };
+    nano_sha3_256_v(gathered, frags, sizeof(frags) / sizeof(frags[0]));
+    
+    for (int i = 0; i < 32; i++) {
+        if (gathered[i] != output[i]) {
+            _write_string("FAIL: Scatter-gather API test\n");
+            _exit(1);
+        }
+    }
+    _write_string("PASS: Scatter-gather API test\n");
+    
+    // Test 6: SHAKE128 / SHAKE256 known answers, and an incremental squeeze
+    // across the 168-byte SHAKE128 rate must match the one-shot stream
+    uint8_t xof[200];
+    uint8_t xof_parts[200];
+    nano_shake_ctx shake;
+    nano_shake128(xof, sizeof(xof), empty, 0);
+    nano_shake128_init(&shake);
+    nano_shake128_squeeze(&shake, xof_parts, 1);
+    nano_shake128_squeeze(&shake, xof_parts + 1, 199);
+    
+    _write_string("SHAKE128: ");
+    for (int i = 0; i < 4; i++) {
+        print_hex_byte(xof[i]);
+    }
+    _write_string("\n");
+    
+    // Expected: 7f9c2ba4e88f827d616045507605853e...
+    if (xof[0] != 0x7f || xof[1] != 0x9c || xof[2] != 0x2b || xof[3] != 0xa4) {
+        _write_string("FAIL: SHAKE128 test\n");
+        _exit(1);
+    }
+    for (int i = 0; i < 200; i++) {
+        if (xof_parts[i] != xof[i]) {
+            _write_string("FAIL: SHAKE128 squeeze test\n");
+            _exit(1);
+        }
+    }
+    
+    // Expected: 483366601360a8771c6863080cc4114d...
+    nano_shake256_init(&shake);
+    nano_shake256_absorb(&shake, abc, 3);
+    nano_shake256_squeeze(&shake, xof, 32);
+    if (xof[0] != 0x48 || xof[1] != 0x33 || xof[2] != 0x66 || xof[3] != 0x60) {
+        _write_string("FAIL: SHAKE256 test\n");
+        _exit(1);
+    }
+    _write_string("PASS: SHAKE API test\n");
+    
+    // Test 7: Midstate after a one-block prefix, two messages from it, and a
+    // cloned context, all must match one-shot over prefix || message
+    nano_sha3_256_ctx midstate;
+    nano_sha3_256_prefix(&midstate, large_input, 136);
+    nano_sha3_256_from_midstate(stepped, &midstate, large_input + 136, 64);
+    nano_sha3_256_from_midstate(streamed, &midstate, large_input + 136, 64);
+    for (int i = 0; i < 32; i++) {
+        if (stepped[i] != output[i] || streamed[i] != output[i]) {
+            _write_string("FAIL: Midstate test\n");
+            _exit(1);
+        }
+    }
+    nano_sha3_256_clone(&ctx, &midstate);
+    nano_sha3_256_update(&ctx, large_input + 136, 64);
+    nano_sha3_256_final(&ctx, streamed);
+    for (int i = 0; i < 32; i++) {
+        if (streamed[i] != output[i]) {
+            _write_string("FAIL: Context clone test\n");
+            _exit(1);
+        }
+    }
+    _write_string("PASS: Midstate/clone test\n");
+    
+    // Test 8: KMAC256 sample #4 (SP 800-185), twice from one keyed context
+    static const uint8_t kmac_expected[16] = {
+        0x20, 0xc5, 0x70, 0xc3, 0x13, 0x46, 0xf7, 0x03,
+        0xc9, 0xac, 0x36, 0xc6, 0x1c, 0x03, 0xcb, 0x64
+    };
+    uint8_t kmac_key[32];
+    uint8_t kmac_msg[4] = {0x00, 0x01, 0x02, 0x03};
+    uint8_t mac[64];
+    for (int i = 0; i < 32; i++) {
+        kmac_key[i] = 0x40 + i;
+    }
+    nano_kmac256_ctx keyed;
+    nano_kmac256_init(&keyed, kmac_key, 32, (const uint8_t *)"My Tagged Application", 21);
+    for (int run = 0; run < 2; run++) {
+        nano_kmac256(mac, 64, &keyed, kmac_msg, 4);
+        for (int i = 0; i < 16; i++) {
+            if (mac[i] != kmac_expected[i]) {
+                _write_string("FAIL: KMAC256 test\n");
+                _exit(1);
+            }
+        }
+    }
+    _write_string("PASS: KMAC256 test\n");
+    
+    // Test 9: NIST vectors through the DMA ping-pong API, 136/200/272-byte halves
+    if (!test_dma()) {
+        _write_string("FAIL: DMA ping-pong test\n");
+        _exit(1);
+    }
+    _write_string("PASS: DMA ping-pong test\n");
+    
+#ifdef HAVE_CHECKPOINT
+    // Test 10: Export / import round trip on the standalone variants
+    if (!test_checkpoint()) {
+        _write_string("FAIL: Checkpoint resume test\n");
+        _exit(1);
+    }
+    _write_string("PASS: Checkpoint resume test\n");
+#endif
+
+#ifdef __ARM_FEATURE_MVE
+    // Test 11: Helium 4-lane kernel against the one-shot on every NIST vector
+    if (!test_x4()) {
+        _write_string("FAIL: Helium x4 test\n");
+        _exit(1);
+    }
+    _write_string("PASS: Helium x4 test\n");
+
+    // Test 12: 4-way SHAKE128/SHAKE256 squeeze against the one-shot XOFs
+    if (!test_shake_x4()) {
+        _write_string("FAIL: SHAKE x4 test\n");
+        _exit(1);
+    }
+    _write_string("PASS: SHAKE x4 test\n");
+#endif
+
+    // Cycle benchmark over a range of sizes (parsed by the script, not a test)
+    bench();
+
     // All tests passed
     _write_string("SUCCESS: All QEMU tests passed\n");
     _exit(0);
@@ -247,8 +748,13 @@ SECTIONS
   } > FLASH
 
   .data : {
+    _sdata = .;
     *(.data*)
+    *(.ramfunc*)
+    . = ALIGN(4);
+    _edata = .;
   } > RAM AT > FLASH
+  _sidata = LOADADDR(.data);
 
   .bss : {
     *(.bss*)
@@ -302,6 +808,22 @@ reset_handler:
     ldr r0, =_stack_top
     mov sp, r0
     
+    // Copy .data and RAM-resident code (.ramfunc) from flash
+    ldr r0, =_sidata
+    ldr r1, =_sdata
+    ldr r2, =_edata
+1:
+    cmp r1, r2
+    bhs 2f
+    ldr r3, [r0]
+    str r3, [r1]
+    adds r0, #4
+    adds r1, #4
+    b 1b
+2:
+    dsb
+    isb
+    
     // Jump to main function (defined in C)
     bl _start
     
@@ -328,7 +850,7 @@ validate_arm_target() {
     local test_dir="${QEMU_TEST_DIR}/${arch}"
     
     # Find the actual static library in the build directory
-    local lib_path=$(find "${BUILD_DIR}/${build_subdir}/target/${rust_target}/release" -name "libnano_sha3_256*.a" | head -1)
+    local lib_path=$(find_arm_library "${build_subdir}" "${rust_target}")
     
     if [[ ! -f "${lib_path}" ]]; then
         log_warn "Skipping ${arch}: library not found at ${BUILD_DIR}/${build_subdir}"
@@ -343,6 +865,7 @@ validate_arm_target() {
     
     # Create test files
     local test_c=$(create_test_harness "${test_dir}")
+    create_nist_vectors "${test_dir}" > /dev/null
     local linker_script=$(create_linker_script "${test_dir}")
     local startup_s=$(create_startup_code "${test_dir}")
     local test_elf="${test_dir}/qemu_test.elf"
@@ -355,10 +878,21 @@ validate_arm_target() {
     
     log_info "Compiling test harness for ${arch}..."
     
+    # Hard-float libraries need the matching C calling convention
+    local float_abi="-mfloat-abi=soft"
+    [[ "${rust_target}" == *eabihf ]] && float_abi="-mfloat-abi=hard"
+    
+    # Checkpoints exist on the in-tree contexts only, not the core crate's
+    local harness_defs="-UHAVE_CHECKPOINT"
+    [[ "${build_subdir}" == *_fast || "${build_subdir}" == *_lowram || "${build_subdir}" == *_asm \
+        || "${build_subdir}" == *_mve || "${build_subdir}" == *_ram ]] && harness_defs="-DHAVE_CHECKPOINT"
+    
     # Compile test harness
     if ! arm-none-eabi-gcc \
         -mcpu="${gcc_cpu}" \
         -mthumb \
+        "${float_abi}" \
+        "${harness_defs}" \
         -nostdlib \
         -nostartfiles \
         -ffreestanding \
@@ -390,7 +924,7 @@ validate_arm_target() {
     local qemu_success=false
     
     # Build QEMU command - machines have built-in CPUs, no need to specify
-    local qemu_cmd="qemu-system-arm -M ${machine} -kernel ${test_elf} -nographic -semihosting-config enable=on,target=native"
+    local qemu_cmd="qemu-system-arm -M ${machine} -icount ${QEMU_ICOUNT} -kernel ${test_elf} -nographic -semihosting-config enable=on,target=native"
     
     # Run QEMU (timeout may return non-zero even on successful _exit(0))
     timeout "${QEMU_TIMEOUT}" ${qemu_cmd} > "${qemu_output}" 2>&1
@@ -422,7 +956,7 @@ validate_arm_target() {
 # Initialize CSV results file
 init_csv() {
     mkdir -p "${RESULTS_DIR}"
-    echo "architecture,qemu_machine,cpu,library_size_bytes,validation_status,test_results,execution_time" > "${CSV_FILE}"
+    echo "architecture,qemu_machine,cpu,library_size_bytes,validation_status,test_results,execution_time,cycles_empty,cycles_8160,cycles_per_block,cycle_source" > "${CSV_FILE}"
 }
 
 # Add result to CSV
@@ -434,8 +968,43 @@ add_csv_result() {
     local status=$5
     local test_results=$6
     local exec_time=$7
+    local cycles=${8:-N/A,N/A,N/A,none}
     
-    echo "${arch},${machine},${cpu},${lib_size},${status},${test_results},${exec_time}" >> "${CSV_FILE}"
+    echo "${arch},${machine},${cpu},${lib_size},${status},${test_results},${exec_time},${cycles}" >> "${CSV_FILE}"
+}
+
+# Cycle figures from the harness's BENCH lines in a QEMU output file:
+# "cycles_empty,cycles_8160,cycles_per_block,cycle_source". DWT counts are
+# cycles as read; SysTick ticks are scaled to instructions with the
+# calibration loop (icount). Per block is (8160 bytes - empty) / 60 blocks.
+bench_cycles() {
+    local qemu_output=$1
+    local source="" calib_insns=0 calib_ticks=0 empty="" full=""
+    local tag src len count
+    
+    [[ -f "${qemu_output}" ]] || { echo "N/A,N/A,N/A,none"; return; }
+    while read -r tag src len count; do
+        [[ "${tag}" == "BENCH" ]] || continue
+        len=$((16#${len})); count=$((16#${count%$'\r'}))
+        if [[ "${src}" == "calib" ]]; then
+            calib_insns=${len}; calib_ticks=${count}
+            continue
+        fi
+        source=${src}
+        [[ ${len} -eq 0 ]] && empty=${count}
+        [[ ${len} -eq 8160 ]] && full=${count}
+    done < "${qemu_output}"
+    
+    if [[ -z "${empty}" || -z "${full}" || ( "${source}" == "systick" && ${calib_ticks} -eq 0 ) ]]; then
+        echo "N/A,N/A,N/A,none"
+        return
+    fi
+    if [[ "${source}" == "dwt" ]]; then
+        awk -v e="${empty}" -v f="${full}" 'BEGIN { printf "%d,%d,%.0f,dwt\n", e, f, (f - e) / 60 }'
+    else
+        awk -v e="${empty}" -v f="${full}" -v i="${calib_insns}" -v t="${calib_ticks}" \
+            'BEGIN { s = i / t; printf "%.0f,%.0f,%.0f,icount\n", e * s, f * s, (f - e) * s / 60 }'
+    fi
 }
 
 # Generate all QEMU validations
@@ -458,13 +1027,15 @@ generate_all_validations() {
     local total=0
     local successful=0
     local failed=0
+    local missing=0
+    local no_cycles=0
     
     for target_info in "${ARM_TARGETS[@]}"; do
         IFS=':' read -r arch machine rust_target gcc_cpu build_subdir <<< "$target_info"
         total=$((total + 1))
         
         # Find the actual static library in the build directory
-        local lib_path=$(find "${BUILD_DIR}/${build_subdir}/target/${rust_target}/release" -name "libnano_sha3_256*.a" | head -1)
+        local lib_path=$(find_arm_library "${build_subdir}" "${rust_target}")
         
         if [[ -f "${lib_path}" ]]; then
             local lib_size=$(stat -c%s "${lib_path}")
@@ -479,14 +1050,22 @@ generate_all_validations() {
             local clean_result=$(echo "${validation_result}" | sed 's/\x1b\[[0-9;]*m//g' | tail -1)
             
             if [[ "${clean_result}" == "PASS" ]]; then
-                successful=$((successful + 1))
-                add_csv_result "${arch}" "${machine}" "${gcc_cpu}" "${lib_size}" "SUCCESS" "ALL_TESTS_PASSED" "${exec_time}s"
+                local cycles=$(bench_cycles "${QEMU_TEST_DIR}/${arch}/qemu_output.txt")
+                if [[ "${cycles}" == N/A,* ]]; then
+                    # Vectors passed but the harness reported no BENCH figures
+                    no_cycles=$((no_cycles + 1))
+                    add_csv_result "${arch}" "${machine}" "${gcc_cpu}" "${lib_size}" "NO_CYCLES" "ALL_TESTS_PASSED" "${exec_time}s" "${cycles}"
+                else
+                    successful=$((successful + 1))
+                    add_csv_result "${arch}" "${machine}" "${gcc_cpu}" "${lib_size}" "SUCCESS" "ALL_TESTS_PASSED" "${exec_time}s" "${cycles}"
+                fi
             else
                 failed=$((failed + 1))
                 add_csv_result "${arch}" "${machine}" "${gcc_cpu}" "${lib_size}" "FAILED" "VALIDATION_FAILED" "${exec_time}s"
             fi
         else
-            failed=$((failed + 1))
+            # Not built (e.g. cortex_m0_asm without BUILD_UNVALIDATED=1)
+            missing=$((missing + 1))
             add_csv_result "${arch}" "${machine}" "${gcc_cpu}" "0" "LIBRARY_MISSING" "NO_LIBRARY" "0s"
         fi
         echo ""
@@ -501,11 +1080,14 @@ generate_all_validations() {
     log_info "Total ARM targets: ${total}"
     log_info "Successful validations: ${successful}"
     log_info "Failed validations: ${failed}"
+    log_info "Passed without cycle figures: ${no_cycles}"
+    log_info "Libraries not built: ${missing}"
     log_info "Results saved to: ${CSV_FILE}"
     log_info "Evidence saved to: ${EVIDENCE_FILE}"
     log_info "Test files: ${QEMU_TEST_DIR}"
     
-    return 0
+    # A run without the cycles_* columns is not the evidence this script is for
+    [[ ${failed} -eq 0 && ${no_cycles} -eq 0 ]]
 }
 
 # Generate comprehensive evidence documentation
@@ -535,8 +1117,29 @@ Each ARM target executes the following validation tests:
 - **Empty Input Test**: NIST test vector for empty string input
 - **"abc" Input Test**: NIST test vector for simple 3-byte input  
 - **Large Input Test**: 1000-byte input to validate stack usage under load
+- **Streaming API Test**: \`nano_sha3_256_init/update/final\` across a block boundary must match one-shot
+- **Step API Test**: \`nano_sha3_256_update_step\` must match one-shot and take one call per rate block
+- **Scatter-Gather Test**: \`nano_sha3_256_v\` over five fragments (one empty, a block straddling three) must match one-shot
+- **Midstate/Clone Test**: messages hashed from a saved 136-byte-prefix midstate and from a cloned context must match one-shot
+- **KMAC256 Test**: SP 800-185 sample #4 MACed twice from one keyed context
+- **DMA Ping-Pong Test**: all ShortMsg and the first 16 LongMsg NIST vectors fed in 136/200/272-byte DMA halves through \`nano_sha3_256_dma_*\`
+- **SHAKE API Test**: SHAKE128/SHAKE256 known answers, incremental squeeze across a rate block must match one-shot
+- **Checkpoint Test** (in-tree variants): every NIST vector exported mid-message, imported into a second context and finished
+- **Helium x4 Test** (MVE builds): every NIST vector through \`nano_sha3_256_x4\` against the one-shot
+- **SHAKE x4 Test** (MVE builds): ML-KEM style seed || indices inputs through \`nano_shake128_x4_*\` / \`nano_shake256_x4_*\` against the one-shot XOFs
 - **Hash Verification**: Output compared against known NIST SHA3-256 test vectors
 
+### Cycle Benchmark
+After the tests the harness times \`nano_sha3_256\` on 0, 64, 136, 1088 and 8160
+bytes. It reads \`DWT->CYCCNT\` where the core has one (Cortex-M3 and up) and
+the counter advances; QEMU does not model it, so under emulation SysTick is
+read instead, with QEMU run as \`-icount ${QEMU_ICOUNT}\` so its clock follows
+retired instructions and a calibration loop of known length converts ticks
+to instructions. **Cycles/Block** is (8160 bytes - empty) / 60 rate blocks;
+the source column says which counter produced it. icount figures count
+instructions (one per cycle), not pipeline or flash wait-state stalls; flash
+the same ELF to a board to get DWT cycles.
+
 ### Tools Used
 - **ARM Cross-Compiler**: \`arm-none-eabi-gcc\` with architecture-specific CPU flags
 - **QEMU System Emulation**: \`qemu-system-arm\` with appropriate machine models
@@ -549,12 +1152,34 @@ EOF
     # Add results table from CSV
     if [[ -f "${CSV_FILE}" ]]; then
         echo "" >> "${EVIDENCE_FILE}"
-        echo "| Architecture | QEMU Machine | CPU | Library Size | Status | Test Results | Exec Time |" >> "${EVIDENCE_FILE}"
-        echo "|--------------|--------------|-----|--------------|--------|--------------|-----------|" >> "${EVIDENCE_FILE}"
+        echo "| Architecture | QEMU Machine | CPU | Library Size | Status | Test Results | Exec Time | Empty Call | 8160 B Call | Cycles/Block | Source |" >> "${EVIDENCE_FILE}"
+        echo "|--------------|--------------|-----|--------------|--------|--------------|-----------|------------|-------------|--------------|--------|" >> "${EVIDENCE_FILE}"
         
         # Skip header line and format results
-        tail -n +2 "${CSV_FILE}" | while IFS=',' read -r arch machine cpu lib_size status test_results exec_time; do
-            echo "| ${arch} | ${machine} | ${cpu} | ${lib_size} B | ${status} | ${test_results} | ${exec_time} |" >> "${EVIDENCE_FILE}"
+        tail -n +2 "${CSV_FILE}" | while IFS=',' read -r arch machine cpu lib_size status test_results exec_time cycles_empty cycles_8160 cycles_per_block cycle_source; do
+            echo "| ${arch} | ${machine} | ${cpu} | ${lib_size} B | ${status} | ${test_results} | ${exec_time} | ${cycles_empty} | ${cycles_8160} | ${cycles_per_block} | ${cycle_source} |" >> "${EVIDENCE_FILE}"
+        done
+    fi
+    
+    # Cortex-M0 kernels side by side, from the build measurements
+    local build_csv="${RESULTS_DIR}/build-results.csv"
+    if [[ -f "${build_csv}" ]] && grep -q '^cortex_m0_asm,' "${build_csv}"; then
+        cat >> "${EVIDENCE_FILE}" << EOF
+
+## Cortex-M0 Kernel Comparison (Rust vs Thumb-1 assembly)
+Flash (.text + .data) and instruction-count cycles from verify-build-staticlibs.sh
+(build-results.csv); both libraries pass the tests above on the microbit machine.
+
+| Library | Permutation | Flash | Cycles/Block | Cycles/Byte | Stack |
+|---------|-------------|-------|--------------|-------------|-------|
+EOF
+        local kernel
+        for kernel in cortex_m0 cortex_m0_asm; do
+            grep "^${kernel}," "${build_csv}" | head -1 | while IFS=',' read -r arch target flash_size stack_bytes cycles_per_byte cycles_per_byte_unaligned cycles_per_block status notes; do
+                local kind="Rust (core crate, opt-level z)"
+                [[ "${arch}" == *_asm ]] && kind="Thumb-1 assembly, bit-interleaved (ffi/armv6m.rs)"
+                echo "| ${arch} | ${kind} | ${flash_size} B | ${cycles_per_block} | ${cycles_per_byte} | ${stack_bytes} B |" >> "${EVIDENCE_FILE}"
+            done
         done
     fi
     
@@ -568,18 +1193,34 @@ EOF
 - **Validation**: Ensures compatibility with lowest-capability ARM Cortex-M processors
 - **Market Coverage**: Ultra-low-power IoT devices, sensor nodes
 
+### Cortex-M0 assembly kernel (cortex_m0_asm)
+- **QEMU Machine**: microbit, same harness as cortex_m0
+- **Kernel**: Hand-written Thumb-1 Keccak-f[1600] on bit-interleaved lanes (\`ci-evidence/ffi/armv6m.rs\`)
+- **Validation**: Every test above runs through the assembly permutation, including the DMA NIST vectors and SHAKE
+
 ### Cortex-M4 (thumbv7em-none-eabi)  
 - **QEMU Machine**: mps2-an385 (ARM MPS2 FPGA board)
 - **CPU Features**: Thumb-2 instruction set, DSP extensions
 - **Validation**: Tests mainstream embedded ARM processor compatibility
 - **Market Coverage**: Industrial controllers, automotive ECUs, consumer electronics
 
+### Cortex-M4 RAM-resident permutation (cortex_m4_ram)
+- **QEMU Machine**: mps2-an386, same harness as cortex_m4_fast
+- **Placement**: Permutation and round constants in \`.ramfunc\` (cargo feature \`ramfunc\`), copied to SRAM by \`startup.s\` and reached from flash through linker veneers
+- **Validation**: Every test above runs from SRAM; the cycle benchmark matches cortex_m4_fast under QEMU (no flash wait states are modelled), on a board the DWT figures show the difference
+
 ### Cortex-M33 (thumbv8m.main-none-eabi)
 - **QEMU Machine**: mps3-an547 (ARM MPS3 FPGA board)
 - **CPU Features**: ARMv8-M architecture, TrustZone security
 - **Validation**: Validates modern secure ARM processor compatibility
 - **Market Coverage**: Security-focused applications, payment systems, secure IoT
 
+### Cortex-M55 Helium (cortex_m55_mve, thumbv8m.main-none-eabihf)
+- **QEMU Machine**: mps3-an547 (Cortex-M55), disabled with the other ARMv8-M rows on QEMU 6.2
+- **Kernel**: 4-lane Keccak in MVE q registers (\`ci-evidence/ffi/helium.rs\`) behind \`nano_sha3_256_x4\`
+- **Validation**: Test 11 runs every NIST vector through \`nano_sha3_256_x4\` against the one-shot; the harness enables CP10/CP11 first
+- **4-way SHAKE**: Test 12 checks \`nano_shake128_x4_squeezeblocks\` (squeezed 1 + 2 blocks) and \`nano_shake256_x4_squeezeblocks\` lane by lane against the one-shot XOFs
+
 ## Validation Confidence
 
 ### High Confidence Indicators
@@ -772,8 +1413,10 @@ main() {
         "validate"|"")
             check_dependencies
             check_arm_libraries
-            generate_all_validations
+            local rc=0
+            generate_all_validations || rc=$?
             show_summary
+            exit ${rc}
             ;;
         "clean")
             clean
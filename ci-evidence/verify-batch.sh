@@ -0,0 +1,218 @@
+#!/bin/bash
+# NanoSHA3-256 Batch Hasher Scaling Validation
+# Measures nano_sha3_256_batch (work-stealing runs on the multi-buffer
+# kernels) on 1 to N worker threads over a batch of independent messages
+# of very different lengths, against sequential nano_sha3_256() calls
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+RESULTS_DIR="${SCRIPT_DIR}/../results"
+LOG_FILE="${RESULTS_DIR}/batch-validation.log"
+CSV_FILE="${RESULTS_DIR}/batch-scaling.csv"
+EVIDENCE_FILE="${RESULTS_DIR}/batch-evidence.md"
+STATICLIBS_DIR="${SCRIPT_DIR}/staticlibs"
+HEADER_FILE="${SCRIPT_DIR}/nano_sha3_256.h"
+STATIC_LIB="libnano_sha3_256_intel_x64.a"
+TEST_DIR="${RESULTS_DIR}/batch_test_intel_x64"
+
+# Largest worker count measured (default: every online core)
+MAX_THREADS="${BATCH_MAX_THREADS:-$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)}"
+
+mkdir -p "${RESULTS_DIR}"
+
+echo "🚀 NanoSHA3-256 Batch Hasher Scaling Validation"
+echo "==============================================="
+
+if [ ! -f "${STATICLIBS_DIR}/${STATIC_LIB}" ]; then
+    echo "❌ Static library not found: ${STATIC_LIB}. Run verify-build-staticlibs.sh first."
+    exit 1
+fi
+
+mkdir -p "${TEST_DIR}"
+cp "${HEADER_FILE}" "${TEST_DIR}/"
+
+# Scaling benchmark: 2^17 messages, lengths log-uniform over 8 B to 4 KiB
+# (indexer-style records: mostly short, a long tail of large ones)
+cat > "${TEST_DIR}/batch_bench.c" << 'EOF'
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "nano_sha3_256.h"
+
+#define MESSAGES (1u << 17)
+#define MIN_LEN 8
+#define MAX_LEN 4096
+#define REPEATS 3
+
+static uint8_t source[MAX_LEN + 251];
+static uint8_t digests[MESSAGES][32];
+static nano_sha3_256_job jobs[MESSAGES];
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Best of REPEATS runs of the whole batch on `threads` workers
+// (0 means sequential nano_sha3_256 calls instead)
+static double time_batch(size_t threads) {
+    double best = 0;
+    for (int r = 0; r < REPEATS; r++) {
+        double start = now_sec();
+        if (threads == 0) {
+            for (uint32_t m = 0; m < MESSAGES; m++) {
+                nano_sha3_256(jobs[m].out, jobs[m].input, jobs[m].len);
+            }
+        } else if (nano_sha3_256_batch(jobs, MESSAGES, threads) != 0) {
+            return -1;
+        }
+        double elapsed = now_sec() - start;
+        if (r == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+int main(int argc, char **argv) {
+    size_t max_threads = argc > 1 ? (size_t)atoi(argv[1]) : 1;
+    uint64_t total = 0;
+    uint32_t x = 2463534242u;
+
+    for (size_t i = 0; i < sizeof(source); i++) {
+        source[i] = (uint8_t)(i * 131 + (i >> 8));
+    }
+    for (uint32_t m = 0; m < MESSAGES; m++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        size_t len = (size_t)(MIN_LEN * pow((double)MAX_LEN / MIN_LEN, (x >> 8) / 16777216.0));
+        jobs[m].input = source + m % 251;
+        jobs[m].len = len;
+        jobs[m].out = digests[m];
+        total += len;
+    }
+
+    // Every slot must match the one-shot before anything is timed
+    if (nano_sha3_256_batch(jobs, MESSAGES, max_threads) != 0) {
+        printf("FAIL: nano_sha3_256_batch rejected the batch\n");
+        return 1;
+    }
+    for (uint32_t m = 0; m < MESSAGES; m++) {
+        uint8_t expected[32];
+        nano_sha3_256(expected, jobs[m].input, jobs[m].len);
+        if (memcmp(expected, digests[m], 32) != 0) {
+            printf("FAIL: job %u (%zu bytes) differs from nano_sha3_256\n", m, jobs[m].len);
+            return 1;
+        }
+    }
+
+    printf("api,threads,messages,bytes,seconds,mb_per_sec,messages_per_sec,speedup,efficiency\n");
+    double sequential = time_batch(0);
+    printf("nano_sha3_256,1,%u,%llu,%.6f,%.2f,%.0f,1.00,1.00\n", MESSAGES, (unsigned long long)total,
+           sequential, total / sequential / 1e6, MESSAGES / sequential);
+
+    double one = 0;
+    for (size_t t = 1; t <= max_threads; t = (t * 2 > max_threads && t < max_threads) ? max_threads : t * 2) {
+        double elapsed = time_batch(t);
+        if (elapsed < 0) {
+            printf("FAIL: nano_sha3_256_batch rejected the batch\n");
+            return 1;
+        }
+        if (t == 1) {
+            one = elapsed;
+        }
+        printf("nano_sha3_256_batch,%zu,%u,%llu,%.6f,%.2f,%.0f,%.2f,%.2f\n", t, MESSAGES,
+               (unsigned long long)total, elapsed, total / elapsed / 1e6, MESSAGES / elapsed,
+               one / elapsed, one / elapsed / t);
+    }
+    return 0;
+}
+EOF
+
+echo "🔨 Compiling batch benchmark..."
+if ! gcc -O2 -Wall -Wextra -std=c99 -o "${TEST_DIR}/batch_bench" \
+    "${TEST_DIR}/batch_bench.c" "${STATICLIBS_DIR}/${STATIC_LIB}" -lpthread -ldl -lm 2>>"${LOG_FILE}"; then
+    echo "❌ Compilation failed (see ${LOG_FILE})"
+    exit 1
+fi
+
+CPU_MODEL=$(grep -m1 "model name" /proc/cpuinfo 2>/dev/null | cut -d: -f2 | sed 's/^ //' || echo "unknown")
+CPU_FLAGS=$(grep -m1 "^flags" /proc/cpuinfo 2>/dev/null || echo "")
+AVX2=$(echo "${CPU_FLAGS}" | grep -qw avx2 && echo "yes" || echo "no")
+AVX512=$(echo "${CPU_FLAGS}" | grep -qw avx512f && echo "yes" || echo "no")
+
+echo "🏃 Running 1 to ${MAX_THREADS} workers on ${CPU_MODEL} (AVX2: ${AVX2}, AVX-512F: ${AVX512})..."
+if ! "${TEST_DIR}/batch_bench" "${MAX_THREADS}" > "${CSV_FILE}" 2>>"${LOG_FILE}"; then
+    echo "❌ Batch benchmark failed"
+    cat "${CSV_FILE}" | tee -a "${LOG_FILE}"
+    echo "FAILED" > "${RESULTS_DIR}/batch-status.txt"
+    exit 1
+fi
+cat "${CSV_FILE}" | tee -a "${LOG_FILE}"
+
+# A curve needs more than one worker on more than one core; otherwise the
+# table is a single-worker result and the evidence says so
+ONLINE_CORES=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+if [ "${MAX_THREADS}" -gt 1 ] && [ "${ONLINE_CORES}" -gt 1 ]; then
+    TABLE_TITLE="Scaling Curve"
+    SCALING_NOTE="- Scaling measured on ${ONLINE_CORES} online cores up to ${MAX_THREADS} workers."
+else
+    TABLE_TITLE="Single-Worker Result"
+    SCALING_NOTE="- No scaling result: this run had ${MAX_THREADS} worker(s) on ${ONLINE_CORES} online core(s).
+  Rerun on a multi-core host for the 1 to N curve."
+fi
+
+# Generate evidence
+cat > "${EVIDENCE_FILE}" << EOF
+# Batch Hasher Evidence
+
+## Validation Method
+- **Approach**: \`nano_sha3_256_batch()\` on 1 to ${MAX_THREADS} worker threads vs sequential \`nano_sha3_256()\`
+- **Library**: ${STATIC_LIB}
+- **CPU**: ${CPU_MODEL} (${ONLINE_CORES} online cores)
+- **AVX2**: ${AVX2} (4-way kernel)
+- **AVX-512F**: ${AVX512} (8-way kernel)
+- **Batch**: 131,072 independent messages, lengths log-uniform over 8 B to 4 KiB
+- **Correctness**: Every digest slot compared against \`nano_sha3_256()\` before timing
+- **Timing**: Best of 3 runs per worker count
+- **Timestamp**: $(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+## ${TABLE_TITLE}
+
+| API | Workers | MB/s | Messages/s | Speedup | Efficiency |
+|-----|---------|------|------------|---------|------------|
+EOF
+
+tail -n +2 "${CSV_FILE}" | while IFS=',' read -r api threads messages bytes seconds mbps mps speedup efficiency; do
+    echo "| ${api} | ${threads} | ${mbps} | ${mps} | ${speedup}x | ${efficiency} |" >> "${EVIDENCE_FILE}"
+done
+
+cat >> "${EVIDENCE_FILE}" << EOF
+
+## Notes
+${SCALING_NOTE}
+- Speedup and efficiency are relative to \`nano_sha3_256_batch\` on one worker;
+  the \`nano_sha3_256\` row shows what the multi-buffer grouping alone buys.
+- Jobs are taken in runs of 64; each worker drains its own range, then steals
+  runs from the back of the others', so the long-message tail spreads over cores.
+- Within a run the jobs are hashed in length order, so each permutation call
+  holds messages of similar length and no lane idles for long.
+- \`BATCH_MAX_THREADS\` sets the largest worker count (default: online cores).
+- NIST correctness of the batch path is covered by verify-nist.sh.
+EOF
+
+echo "ACHIEVED" > "${RESULTS_DIR}/batch-status.txt"
+
+echo ""
+echo "📋 Evidence generated:"
+echo "  - Results: ${CSV_FILE}"
+echo "  - Evidence: ${EVIDENCE_FILE}"
+echo "  - Status: ${RESULTS_DIR}/batch-status.txt"
+echo "  - Log: ${LOG_FILE}"
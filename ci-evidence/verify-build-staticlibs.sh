@@ -14,6 +14,7 @@ NC='\033[0m' # No Color
 
 PROJECT_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
 STATICLIBS_DIR="${PROJECT_ROOT}/ci-evidence/staticlibs"
+FFI_DIR="${PROJECT_ROOT}/ci-evidence/ffi"
 BUILD_DIR="${PROJECT_ROOT}/ci-evidence/build"
 TARGET_DIR="${PROJECT_ROOT}/target"
 RESULTS_DIR="${PROJECT_ROOT}/results"
@@ -26,21 +27,62 @@ declare -A TARGETS=(
     ["cortex_m0"]="thumbv6m-none-eabi"        # Cortex-M0/M0+ - ultra-low-power
     ["cortex_m4"]="thumbv7em-none-eabi"       # Cortex-M4/M7 - performance embedded
     ["cortex_m33"]="thumbv8m.main-none-eabi"  # Cortex-M33/M55 - TrustZone security
+    # Speed variants (bit-interleaved lanes, opt-level 3) for cycle-bound paths
+    ["cortex_m4_fast"]="thumbv7em-none-eabi"
+    ["cortex_m33_fast"]="thumbv8m.main-none-eabi"
+    # cortex_m4_fast with the permutation and round constants run from RAM
+    ["cortex_m4_ram"]="thumbv7em-none-eabi"
+    # Same kernel with the permutation in ITCM and its constants in DTCM (Cortex-M7)
+    ["cortex_m7_tcm"]="thumbv7em-none-eabihf"
+    # Low-RAM variant (in-place permutation) for interrupt and small task stacks
+    ["cortex_m0_lowram"]="thumbv6m-none-eabi"
     # Linux targets (for timing validation)
     ["intel_x64"]="x86_64-unknown-linux-gnu"  # Intel x86_64 Linux (native timing)
     ["arm_linux"]="armv7-unknown-linux-gnueabihf"  # ARM Linux (QEMU timing)
+    ["aarch64"]="aarch64-unknown-linux-gnu"   # ARM64 Linux gateways (ARMv8.2-SHA3 kernel)
 )
 
+# Kernels without a committed on-target NIST run and cycles/flash comparison
+# are not shipped. BUILD_UNVALIDATED=1 builds them so that evidence can be
+# produced (verify-arm-qemu.sh picks them up once the libraries exist).
+BUILD_UNVALIDATED="${BUILD_UNVALIDATED:-0}"
+if [[ "${BUILD_UNVALIDATED}" == "1" ]]; then
+    TARGETS+=(
+        # Thumb-1 assembly permutation (bit-interleaved) against the Rust cortex_m0
+        ["cortex_m0_asm"]="thumbv6m-none-eabi"
+        # Helium (MVE) 4-lane kernel for Cortex-M55/M85 (built with target-cpu=cortex-m55)
+        ["cortex_m55_mve"]="thumbv8m.main-none-eabihf"
+    )
+fi
+
 # Size targets (only for embedded ARM Cortex targets)
 declare -A SIZE_TARGETS=(
     ["cortex_m0"]="3500"    # 3.5KB max target (realistic with nightly optimization)
     ["cortex_m4"]="3500"    # 3.5KB max target
     ["cortex_m33"]="3500"   # 3.5KB max target
+    # Speed variants trade flash for cycles, size is reported but not capped
+    ["cortex_m4_fast"]="999999"
+    ["cortex_m33_fast"]="999999"
+    ["cortex_m4_ram"]="999999"
+    ["cortex_m7_tcm"]="999999"
+    ["cortex_m0_lowram"]="3500"
+    ["cortex_m0_asm"]="3500"
+    ["cortex_m55_mve"]="999999"
     # Linux targets don't have size constraints (used for timing validation only)
     ["intel_x64"]="999999"  # No size limit for timing validation
     ["arm_linux"]="999999"  # No size limit for timing validation
+    ["aarch64"]="999999"    # No size limit for timing validation
 )
 
+# Unroll profile matrix: every embedded core above is also built at each
+# opt-level x rounds-per-loop combination (ffi/scalar.rs on the ffi/keccak.rs
+# permutation), so flash, stack and cycles/block can be read off one table.
+# BUILD_PROFILE_MATRIX=0 skips it.
+BUILD_PROFILE_MATRIX="${BUILD_PROFILE_MATRIX:-1}"
+PROFILE_ARCHS=("cortex_m0" "cortex_m4" "cortex_m33")
+PROFILE_OPT_LEVELS=("z" "s" "3")
+PROFILE_UNROLLS=(1 2 24)
+
 # Logging functions
 log_info() {
     echo -e "${GREEN}[INFO]${NC} $1"
@@ -138,8 +180,17 @@ create_standalone_project() {
     mkdir -p "${project_dir}"
     
     # Different project setup for Linux vs embedded targets
-    if [[ "${arch}" == "intel_x64" || "${arch}" == "arm_linux" ]]; then
+    if [[ "${arch}" == "intel_x64" || "${arch}" == "arm_linux" || "${arch}" == "aarch64" ]]; then
         # Linux targets: Create C-compatible static library
+        # intel_x64 and aarch64 export their own runtime-dispatched
+        # nano_sha3_256 (ffi/dispatch.rs), so they must not link the core crate's
+        local core_dependency='nano-sha3-256 = { path = "../../../" }'
+        local default_features='default = []'
+        if [[ "${arch}" == "intel_x64" || "${arch}" == "aarch64" ]]; then
+            core_dependency=''
+            default_features='default = ["dispatch"]'
+        fi
+        
         cat > "${project_dir}/Cargo.toml" << EOF
 [package]
 name = "nano_sha3_256_${arch}"
@@ -147,7 +198,22 @@ version = "0.1.0"
 edition = "2021"
 
 [dependencies]
-nano-sha3-256 = { path = "../../../" }
+${core_dependency}
+
+[features]
+${default_features}
+interleaved = []         # Bit-interleaved speed variant (cortex_*_fast only)
+dispatch = []            # Runtime CPU dispatch of the permutation (intel_x64, aarch64)
+scalar = []              # Scalar sponge context, no core crate (unroll profile builds)
+unroll2 = []             # Permutation loop runs two rounds per iteration
+unroll24 = []            # Permutation fully unrolled (24 straight-line rounds)
+lowram = []              # In-place permutation, state only in the context (cortex_m0_lowram only)
+asm_m0 = []              # Thumb-1 assembly permutation under "interleaved" (cortex_m0_asm only)
+helium = []              # Helium (MVE) 4-lane kernel for nano_sha3_256_x4 (cortex_m55_mve only)
+ramfunc = []             # Permutation + constants in .ramfunc / .ramfunc.rodata (cortex_m4_ram)
+tcm = []                 # Permutation + constants in .itcm / .dtcm (Cortex-M7 TCMs)
+counters = []            # Hot-path counters + nano_sha3_256_get_counters (off by default)
+counter_cycles = ["counters"]  # Counters also accumulate rdtsc / DWT->CYCCNT cycles
 
 [lib]
 name = "nano_sha3_256"
@@ -164,9 +230,141 @@ EOF
         # Create lib.rs that re-exports the existing C-compatible function
         mkdir -p "${project_dir}/src"
         cat > "${project_dir}/src/lib.rs" << 'EOF'
+// core::arch::arm NEON intrinsics and feature detection are nightly-only,
+// arm_linux builds with RUSTC_BOOTSTRAP=1 for the nano_sha3_256_x2 kernel
+#![cfg_attr(
+    all(target_arch = "arm", target_os = "linux"),
+    feature(stdarch_arm_neon_intrinsics, stdarch_arm_feature_detection, arm_target_feature)
+)]
+
 // Re-export the existing C-compatible function from nano-sha3-256
+#[cfg(not(any(feature = "dispatch", feature = "interleaved", feature = "scalar")))]
 pub use nano_sha3_256::*;
+
+// Streaming C API (nano_sha3_256_init/update/final), plus the dispatched
+// one-shot on intel_x64 and aarch64 (or the bit-interleaved / scalar one in
+// the intel_x64 validation builds)
+mod ffi;
+EOF
+        cp -r "${FFI_DIR}" "${project_dir}/src/ffi"
+    elif [[ "${arch}" == *_fast || "${arch}" == *_lowram || "${arch}" == *_asm || "${arch}" == *_mve \
+        || "${arch}" == *_ram || "${arch}" == *_tcm ]]; then
+        # Standalone variants (no core crate), C API on an in-tree kernel:
+        # _fast the bit-interleaved Keccak from ffi/interleaved.rs, optimized
+        # for cycles instead of flash; _lowram the in-place one from
+        # ffi/lowram.rs, optimized for flash with the smallest stack; _asm the
+        # interleaved context on the Thumb-1 permutation from ffi/armv6m.rs;
+        # _mve the interleaved context plus the 4-lane Helium kernel from
+        # ffi/helium.rs behind nano_sha3_256_x4; _ram the _fast kernel with
+        # its permutation and round constants in .ramfunc; _tcm the same in
+        # .itcm / .dtcm
+        local variant_feature='"interleaved"'
+        local variant_opt='3            # Optimize for speed (cycle-bound secure boot)'
+        local variant_kernel="bit-interleaved kernel"
+        if [[ "${arch}" == *_lowram ]]; then
+            variant_feature='"lowram"'
+            variant_opt='"z"          # Optimize for size'
+            variant_kernel="in-place low-RAM kernel"
+        elif [[ "${arch}" == *_asm ]]; then
+            variant_feature='"interleaved", "asm_m0"'
+            variant_opt='"z"          # Optimize for size (the permutation is hand-written)'
+            variant_kernel="Thumb-1 assembly kernel"
+        elif [[ "${arch}" == *_ram ]]; then
+            variant_feature='"interleaved", "ramfunc"'
+            variant_kernel="bit-interleaved kernel, permutation in .ramfunc"
+        elif [[ "${arch}" == *_tcm ]]; then
+            variant_feature='"interleaved", "tcm"'
+            variant_kernel="bit-interleaved kernel, permutation in .itcm, constants in .dtcm"
+        elif [[ "${arch}" == *_mve ]]; then
+            variant_feature='"interleaved", "helium"'
+            variant_opt='3            # Optimize for speed (4-stream MVE kernel)'
+            variant_kernel="bit-interleaved kernel, Helium (MVE) 4-lane kernel"
+            # No thumbv8.1m.main target in rustc: the ARMv8-M Mainline
+            # hard-float target with the Cortex-M55 CPU enables MVE
+            mkdir -p "${project_dir}/.cargo"
+            cat > "${project_dir}/.cargo/config.toml" << 'EOF'
+[target.thumbv8m.main-none-eabihf]
+rustflags = ["-C", "target-cpu=cortex-m55"]
+EOF
+        fi
+        cat > "${project_dir}/Cargo.toml" << EOF
+[package]
+name = "nano_sha3_256_${arch}"
+version = "0.1.0"
+edition = "2021"
+
+[features]
+default = [${variant_feature}]
+interleaved = []         # Bit-interleaved 32-bit lanes, unrolled rounds
+dispatch = []            # Runtime CPU dispatch of the permutation (intel_x64, aarch64)
+scalar = []              # Scalar sponge context, no core crate (unroll profile builds)
+unroll2 = []             # Permutation loop runs two rounds per iteration
+unroll24 = []            # Permutation fully unrolled (24 straight-line rounds)
+lowram = []              # In-place permutation, state only in the context (cortex_m0_lowram only)
+asm_m0 = []              # Thumb-1 assembly permutation under "interleaved" (cortex_m0_asm only)
+helium = []              # Helium (MVE) 4-lane kernel for nano_sha3_256_x4 (cortex_m55_mve only)
+ramfunc = []             # Permutation + constants in .ramfunc / .ramfunc.rodata (cortex_m4_ram)
+tcm = []                 # Permutation + constants in .itcm / .dtcm (Cortex-M7 TCMs)
+counters = []            # Hot-path counters + nano_sha3_256_get_counters (off by default)
+counter_cycles = ["counters"]  # Counters also accumulate rdtsc / DWT->CYCCNT cycles
+
+[[bin]]
+name = "nano_sha3_256_${arch}"
+path = "main.rs"
+
+# C API static library linked by the QEMU harness
+[lib]
+name = "nano_sha3_256_capi"
+path = "src/lib.rs"
+crate-type = ["staticlib"]
+
+[profile.release]
+opt-level = ${variant_opt}
+lto = true               # Link-time optimization
+codegen-units = 1        # Single codegen unit for better optimization
+panic = "abort"          # Abort on panic for smaller binaries
+strip = true             # Strip debug symbols
 EOF
+
+        # Minimal main.rs for flash measurement of the same code
+        cat > "${project_dir}/main.rs" << 'EOF'
+#![no_std]
+#![no_main]
+// core::simd for the Helium kernel (nightly, as is build-std)
+#![cfg_attr(feature = "helium", feature(portable_simd))]
+
+#[path = "src/ffi/mod.rs"]
+mod ffi;
+
+#[panic_handler]
+fn panic(_info: &core::panic::PanicInfo) -> ! {
+    loop {}
+}
+
+#[no_mangle]
+pub extern "C" fn _start() -> ! {
+    // Call SHA3-256 function to ensure it's included in binary
+    let input = b"test";
+    let mut hash = [0u8; 32];
+    unsafe { ffi::nano_sha3_256(hash.as_mut_ptr(), input.as_ptr(), input.len()) };
+    loop {}
+}
+EOF
+
+        mkdir -p "${project_dir}/src"
+        cat > "${project_dir}/src/lib.rs" << EOF
+#![no_std]
+#![cfg_attr(feature = "helium", feature(portable_simd))]
+
+// Full C API (one-shot + streaming) on the ${variant_kernel}
+mod ffi;
+
+#[panic_handler]
+fn panic(_info: &core::panic::PanicInfo) -> ! {
+    loop {}
+}
+EOF
+        cp -r "${FFI_DIR}" "${project_dir}/src/ffi"
     else
         # Embedded targets: Create minimal binary for size measurement
         cat > "${project_dir}/Cargo.toml" << EOF
@@ -178,10 +376,30 @@ edition = "2021"
 [dependencies]
 nano-sha3-256 = { path = "../../../", default-features = false, features = ["panic-handler"] }
 
+[features]
+interleaved = []         # Bit-interleaved speed variant (cortex_*_fast only)
+dispatch = []            # Runtime CPU dispatch of the permutation (intel_x64, aarch64)
+scalar = []              # Scalar sponge context, no core crate (unroll profile builds)
+unroll2 = []             # Permutation loop runs two rounds per iteration
+unroll24 = []            # Permutation fully unrolled (24 straight-line rounds)
+lowram = []              # In-place permutation, state only in the context (cortex_m0_lowram only)
+asm_m0 = []              # Thumb-1 assembly permutation under "interleaved" (cortex_m0_asm only)
+helium = []              # Helium (MVE) 4-lane kernel for nano_sha3_256_x4 (cortex_m55_mve only)
+ramfunc = []             # Permutation + constants in .ramfunc / .ramfunc.rodata (cortex_m4_ram)
+tcm = []                 # Permutation + constants in .itcm / .dtcm (Cortex-M7 TCMs)
+counters = []            # Hot-path counters + nano_sha3_256_get_counters (off by default)
+counter_cycles = ["counters"]  # Counters also accumulate rdtsc / DWT->CYCCNT cycles
+
 [[bin]]
 name = "nano_sha3_256_${arch}"
 path = "main.rs"
 
+# C API static library linked by the QEMU harness
+[lib]
+name = "nano_sha3_256_capi"
+path = "src/lib.rs"
+crate-type = ["staticlib"]
+
 [profile.release]
 opt-level = "z"          # Optimize for size
 lto = true               # Link-time optimization
@@ -205,11 +423,485 @@ pub extern "C" fn _start() -> ! {
     loop {}
 }
 EOF
+
+        # Create lib.rs exposing the full C API for bare-metal linking
+        mkdir -p "${project_dir}/src"
+        cat > "${project_dir}/src/lib.rs" << 'EOF'
+#![no_std]
+
+// Re-export the existing C-compatible function from nano-sha3-256
+pub use nano_sha3_256::*;
+
+// Streaming C API (nano_sha3_256_init/update/final)
+mod ffi;
+EOF
+        cp -r "${FFI_DIR}" "${project_dir}/src/ffi"
     fi
 
     log_info "✓ Created standalone project: ${project_dir}"
 }
 
+# Locate the QEMU TCG instruction-counting plugin (libinsn.so)
+find_insn_plugin() {
+    local dir
+    for dir in "${QEMU_PLUGIN_DIR:-}" /usr/lib/qemu/plugins /usr/local/lib/qemu/plugins \
+               /usr/lib/x86_64-linux-gnu/qemu /usr/libexec/qemu/plugins; do
+        if [[ -n "${dir}" && -f "${dir}/libinsn.so" ]]; then
+            echo "${dir}/libinsn.so"
+            return 0
+        fi
+    done
+    return 1
+}
+
+# Measure cycles/byte of a Cortex-M C API library under QEMU
+# Counts executed instructions for an empty and a BENCH_BYTES message and
+# divides the difference by BENCH_BYTES, so startup code cancels out.
+# Cortex-M0/M4/M33 are single-issue, one instruction is taken as one cycle
+# (a lower bound: loads and taken branches cost more on silicon). Cortex-M7
+# dual-issues, so there the same count is an upper bound at zero wait states.
+# The message starts `offset` bytes past an 8-byte boundary: 0 exercises the
+# aligned whole-word absorb path, 1 the unaligned one. An optional message
+# size and unit scale the result (8160 bytes x 136 = cycles per rate block).
+# With lanes=4 the harness hashes four such messages in one
+# nano_sha3_256_x4 call and the count is per byte of all four.
+# Prints N/A when the toolchain, QEMU or the plugin is missing.
+measure_cycles_per_byte() {
+    local target=$1
+    local lib_path=$2
+    local bench_dir=$3
+    local offset=${4:-0}
+    local bench_bytes=${5:-8192}
+    local unit=${6:-1}
+    local lanes=${7:-1}
+    local machine cpu
+
+    case "${target}" in
+        thumbv6m-none-eabi)      machine="microbit";   cpu="cortex-m0" ;;
+        thumbv7em-none-eabi)     machine="mps2-an386"; cpu="cortex-m4" ;;
+        thumbv7em-none-eabihf)   machine="mps2-an500"; cpu="cortex-m7" ;;
+        thumbv8m.main-none-eabi) machine="mps2-an505"; cpu="cortex-m33" ;;
+        thumbv8m.main-none-eabihf) machine="mps3-an547"; cpu="cortex-m55" ;;
+        *) echo "N/A"; return 0 ;;
+    esac
+    # Hard-float libraries need the matching C calling convention
+    local float_abi=""
+    [[ "${target}" == *eabihf ]] && float_abi="-mfloat-abi=hard"
+
+    local plugin
+    if ! plugin=$(find_insn_plugin) || ! command -v arm-none-eabi-gcc &> /dev/null \
+        || ! command -v qemu-system-arm &> /dev/null || [[ ! -f "${lib_path}" ]]; then
+        echo "N/A"
+        return 0
+    fi
+
+    mkdir -p "${bench_dir}"
+    cp "${PROJECT_ROOT}/ci-evidence/nano_sha3_256.h" "${bench_dir}/"
+
+    cat > "${bench_dir}/bench.ld" << 'EOF'
+MEMORY
+{
+  FLASH : ORIGIN = 0x00000000, LENGTH = 256K
+  RAM   : ORIGIN = 0x20000000, LENGTH = 16K
+}
+
+ENTRY(reset_handler)
+
+SECTIONS
+{
+  .text : {
+    KEEP(*(.vector_table))
+    *(.text*)
+    *(.rodata*)
+  } > FLASH
+
+  /* cortex_m4_ram / cortex_m7_tcm: the permutation runs from RAM, copied by
+     reset_handler (AN500 has no TCMs, so .itcm / .dtcm go to the same SRAM) */
+  .data : { _sdata = .; *(.data*) *(.ramfunc*) *(.itcm*) *(.dtcm*) . = ALIGN(4); _edata = .; } > RAM AT > FLASH
+  _sidata = LOADADDR(.data);
+
+  .bss : { *(.bss*) *(COMMON) } > RAM
+
+  /DISCARD/ : { *(.ARM.exidx*) }
+
+  _stack_top = ORIGIN(RAM) + LENGTH(RAM);
+}
+EOF
+
+    cat > "${bench_dir}/bench.c" << 'EOF'
+#include <stdint.h>
+#include <stddef.h>
+
+#include "nano_sha3_256.h"
+
+extern uint32_t _stack_top, _sdata, _edata, _sidata;
+void reset_handler(void);
+
+__attribute__((section(".vector_table"), used))
+const void *const vector_table[2] = { &_stack_top, (const void *)reset_handler };
+
+// Constant-time kernel: the message content does not change the count
+__attribute__((aligned(8)))
+static const uint8_t bench_input[BENCH_BYTES + 8];
+
+// FP and MVE instructions fault until CP10/CP11 are enabled in CPACR
+static void enable_fpu(void) {
+#if defined(__ARM_FP) || defined(__ARM_FEATURE_MVE)
+    *(volatile uint32_t *)0xE000ED88 |= 0xFu << 20;
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+#endif
+}
+
+// .data and any RAM-resident code (.ramfunc) from their flash load image
+// (volatile: no memcpy call before the library's code is in place)
+static void copy_data(void) {
+    const uint32_t *src = &_sidata;
+    for (volatile uint32_t *dst = &_sdata; dst < &_edata; dst++) {
+        *dst = *src++;
+    }
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+}
+
+void reset_handler(void) {
+    copy_data();
+    enable_fpu();
+#if BENCH_LANES == 4
+    static uint8_t out[4][32];
+    uint8_t *const outs[4] = { out[0], out[1], out[2], out[3] };
+    const uint8_t *const in = bench_input + BENCH_OFFSET;
+    const uint8_t *const ins[4] = { in, in, in, in };
+    const size_t lens[4] = { BENCH_BYTES, BENCH_BYTES, BENCH_BYTES, BENCH_BYTES };
+    nano_sha3_256_x4(outs, ins, lens);
+#else
+    uint8_t out[32];
+    nano_sha3_256(out, bench_input + BENCH_OFFSET, BENCH_BYTES);
+#endif
+    __asm volatile("" : : "r"(out) : "memory");
+
+    register int r0 asm("r0") = 0x18; // SYS_EXIT
+    register int r1 asm("r1") = 0;
+    asm volatile ("bkpt #0xAB" : : "r"(r0), "r"(r1) : "memory");
+    while (1);
+}
+EOF
+
+    local bytes insns=()
+    for bytes in 0 "${bench_bytes}"; do
+        local elf="${bench_dir}/bench_${offset}_${bytes}_x${lanes}.elf"
+        local insn_log="${bench_dir}/insn_${offset}_${bytes}_x${lanes}.log"
+        if ! arm-none-eabi-gcc -mcpu="${cpu}" -mthumb ${float_abi} -nostdlib -nostartfiles -ffreestanding -Os \
+            -DBENCH_BYTES="${bytes}" -DBENCH_OFFSET="${offset}" -DBENCH_LANES="${lanes}" \
+            -I "${bench_dir}" -T "${bench_dir}/bench.ld" \
+            "${bench_dir}/bench.c" "${lib_path}" -o "${elf}" \
+            2>"${bench_dir}/compile.log"; then
+            echo "N/A"
+            return 0
+        fi
+
+        timeout 60 qemu-system-arm -M "${machine}" -kernel "${elf}" -nographic \
+            -semihosting-config enable=on,target=native \
+            -plugin "${plugin}" -d plugin -D "${insn_log}" > /dev/null 2>&1 || true
+
+        local count=$(grep -E "insns" "${insn_log}" 2>/dev/null | tail -1 | grep -oE '[0-9]+$' || true)
+        if [[ -z "${count}" ]]; then
+            echo "N/A"
+            return 0
+        fi
+        insns+=("${count}")
+    done
+
+    awk -v a="${insns[0]}" -v b="${insns[1]}" -v n="${bench_bytes}" -v u="${unit}" -v l="${lanes}" \
+        'BEGIN { printf "%.2f", (b - a) * u / (n * l) }'
+}
+
+# Flash taken by the SHAKE / cSHAKE / KMAC sponge's own permutation entry
+# (sponge::permute_state or interleaved::permute_state) in a C API library.
+# dispatch and lowram hand the backend's permutation to the sponge (0); the
+# interleaved libraries add only a lane-conversion wrapper round theirs; the
+# core-crate libraries carry a second, 64-bit Keccak-f[1600] next to the
+# core's, and this is its size. Prints N/A when nm or the library is missing.
+measure_sponge_permute_bytes() {
+    local lib_path=$1
+
+    if ! command -v nm &> /dev/null || [[ ! -f "${lib_path}" ]]; then
+        echo "N/A"
+        return 0
+    fi
+    nm -C --print-size --radix=d "${lib_path}" 2>/dev/null \
+        | awk '/ [tT] .*(sponge|interleaved)::permute_state$/ {s+=$2} END{print s+0}'
+}
+
+# Measure the peak stack of a Cortex-M C API library under QEMU
+# The harness paints everything between .bss and its own stack pointer,
+# runs the one-shot and the streaming API on a 300-byte message (two
+# permutations through the buffered path plus padding), then scans for the
+# deepest overwritten word and prints the distance over semihosting.
+# Prints N/A when the toolchain or QEMU is missing.
+measure_stack_bytes() {
+    local target=$1
+    local lib_path=$2
+    local bench_dir=$3
+    local api=${4:-all}       # "stream": streaming API on a static context only
+    local machine cpu
+
+    case "${target}" in
+        thumbv6m-none-eabi)      machine="microbit";   cpu="cortex-m0" ;;
+        thumbv7em-none-eabi)     machine="mps2-an386"; cpu="cortex-m4" ;;
+        thumbv8m.main-none-eabi) machine="mps2-an505"; cpu="cortex-m33" ;;
+        thumbv8m.main-none-eabihf) machine="mps3-an547"; cpu="cortex-m55" ;;
+        *) echo "N/A"; return 0 ;;
+    esac
+    # Hard-float libraries need the matching C calling convention
+    local float_abi=""
+    [[ "${target}" == *eabihf ]] && float_abi="-mfloat-abi=hard"
+
+    if ! command -v arm-none-eabi-gcc &> /dev/null || ! command -v qemu-system-arm &> /dev/null \
+        || [[ ! -f "${lib_path}" ]]; then
+        echo "N/A"
+        return 0
+    fi
+
+    mkdir -p "${bench_dir}"
+    cp "${PROJECT_ROOT}/ci-evidence/nano_sha3_256.h" "${bench_dir}/"
+
+    cat > "${bench_dir}/stack.ld" << 'EOF'
+MEMORY
+{
+  FLASH : ORIGIN = 0x00000000, LENGTH = 256K
+  RAM   : ORIGIN = 0x20000000, LENGTH = 16K
+}
+
+ENTRY(reset_handler)
+
+SECTIONS
+{
+  .text : {
+    KEEP(*(.vector_table))
+    *(.text*)
+    *(.rodata*)
+  } > FLASH
+
+  .data : { _sdata = .; *(.data*) *(.ramfunc*) . = ALIGN(4); _edata = .; } > RAM AT > FLASH
+  _sidata = LOADADDR(.data);
+
+  .bss : { *(.bss*) *(COMMON) _ebss = .; } > RAM
+
+  /DISCARD/ : { *(.ARM.exidx*) }
+
+  _stack_top = ORIGIN(RAM) + LENGTH(RAM);
+}
+EOF
+
+    cat > "${bench_dir}/stack.c" << 'EOF'
+#include <stdint.h>
+#include <stddef.h>
+
+#include "nano_sha3_256.h"
+
+#define PAINT 0xA5A5A5A5u
+#define STACK_BENCH_BYTES 300
+
+extern uint32_t _stack_top, _ebss, _sdata, _edata, _sidata;
+void reset_handler(void);
+
+__attribute__((section(".vector_table"), used))
+const void *const vector_table[2] = { &_stack_top, (const void *)reset_handler };
+
+static const uint8_t bench_input[STACK_BENCH_BYTES];
+static nano_sha3_256_ctx ctx;
+
+// FP and MVE instructions fault until CP10/CP11 are enabled in CPACR
+static void enable_fpu(void) {
+#if defined(__ARM_FP) || defined(__ARM_FEATURE_MVE)
+    *(volatile uint32_t *)0xE000ED88 |= 0xFu << 20;
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+#endif
+}
+
+// .data and any RAM-resident code (.ramfunc) from their flash load image
+// (volatile: no memcpy call before the library's code is in place)
+static void copy_data(void) {
+    const uint32_t *src = &_sidata;
+    for (volatile uint32_t *dst = &_sdata; dst < &_edata; dst++) {
+        *dst = *src++;
+    }
+    __asm volatile ("dsb\n\tisb" : : : "memory");
+}
+
+static void semihost(int op, const void *arg) {
+    register int r0 asm("r0") = op;
+    register const void *r1 asm("r1") = arg;
+    asm volatile ("bkpt #0xAB" : "+r"(r0) : "r"(r1) : "memory");
+}
+
+void reset_handler(void) {
+    uint8_t out[32];
+    char text[24] = "stack=";
+    uint32_t *sp;
+    volatile uint32_t *p;
+
+    copy_data();
+    enable_fpu();
+
+    // Nothing lives below our own frame yet (no interrupts enabled)
+    asm volatile ("mov %0, sp" : "=r"(sp));
+    for (p = &_ebss; p < sp; p++) {
+        *p = PAINT;
+    }
+
+#ifndef STACK_STREAM_ONLY
+    nano_sha3_256(out, bench_input, STACK_BENCH_BYTES);
+#endif
+    nano_sha3_256_init(&ctx);
+    nano_sha3_256_update(&ctx, bench_input, 7);
+    nano_sha3_256_update(&ctx, bench_input + 7, STACK_BENCH_BYTES - 7);
+    nano_sha3_256_final(&ctx, out);
+    asm volatile ("" : : "r"(out) : "memory");
+
+    for (p = &_ebss; p < sp && *p == PAINT; p++) {
+    }
+    uint32_t used = (uint32_t)((uintptr_t)sp - (uintptr_t)p);
+
+    // Decimal, without pulling in a libc
+    char digits[12];
+    int n = 0, i = 6;
+    do {
+        digits[n++] = (char)('0' + used % 10);
+        used /= 10;
+    } while (used);
+    while (n) {
+        text[i++] = digits[--n];
+    }
+    text[i++] = '\n';
+    text[i] = '\0';
+    semihost(0x04, text); // SYS_WRITE0
+
+    semihost(0x18, (const void *)0x20026); // SYS_EXIT, ADP_Stopped_ApplicationExit
+    while (1);
+}
+EOF
+
+    local api_flags=""
+    [[ "${api}" == "stream" ]] && api_flags="-DSTACK_STREAM_ONLY"
+
+    if ! arm-none-eabi-gcc -mcpu="${cpu}" -mthumb ${float_abi} -nostdlib -nostartfiles -ffreestanding -Os ${api_flags} \
+        -I "${bench_dir}" -T "${bench_dir}/stack.ld" \
+        "${bench_dir}/stack.c" "${lib_path}" -o "${bench_dir}/stack.elf" \
+        2>"${bench_dir}/stack_compile.log"; then
+        echo "N/A"
+        return 0
+    fi
+
+    local used
+    used=$(timeout 60 qemu-system-arm -M "${machine}" -kernel "${bench_dir}/stack.elf" -nographic \
+        -semihosting-config enable=on,target=native 2>/dev/null | grep -oE 'stack=[0-9]+' | tail -1 | cut -d= -f2 || true)
+    echo "${used:-N/A}"
+}
+
+# Link a "tcm" C API library with the linker script fragment from the README
+# ("Running the permutation from RAM or TCM") on an STM32H7-style Cortex-M7
+# map, then check that .itcm sits in ITCM and .dtcm in DTCM, both with load
+# addresses in flash. Prints PASSED or FAILED, N/A when the toolchain is missing.
+check_tcm_link() {
+    local lib_path=$1
+    local bench_dir=$2
+
+    if ! command -v arm-none-eabi-gcc &> /dev/null || [[ ! -f "${lib_path}" ]]; then
+        echo "N/A"
+        return 0
+    fi
+
+    mkdir -p "${bench_dir}"
+    cp "${PROJECT_ROOT}/ci-evidence/nano_sha3_256.h" "${bench_dir}/"
+
+    cat > "${bench_dir}/tcm.ld" << 'EOF'
+MEMORY
+{
+  ITCM  : ORIGIN = 0x00000000, LENGTH = 64K
+  FLASH : ORIGIN = 0x08000000, LENGTH = 1M
+  DTCM  : ORIGIN = 0x20000000, LENGTH = 128K
+  RAM   : ORIGIN = 0x24000000, LENGTH = 512K
+}
+
+ENTRY(reset_handler)
+
+SECTIONS
+{
+  .text : {
+    KEEP(*(.vector_table))
+    *(.text*)
+    *(.rodata*)
+  } > FLASH
+
+  .data : {
+    _sdata = .;
+    *(.data*)
+    *(.ramfunc*)          /* "ramfunc": permutation + round constants */
+    . = ALIGN(4);
+    _edata = .;
+  } > RAM AT > FLASH
+
+  /* "tcm" (Cortex-M7): copy .itcm to ITCM and .dtcm to DTCM the same way */
+  .itcm : { *(.itcm*) } > ITCM AT > FLASH
+  .dtcm : { *(.dtcm*) } > DTCM AT > FLASH
+
+  .bss : { *(.bss*) *(COMMON) } > RAM
+
+  /DISCARD/ : { *(.ARM.exidx*) }
+
+  _stack_top = ORIGIN(RAM) + LENGTH(RAM);
+}
+EOF
+
+    cat > "${bench_dir}/tcm.c" << 'EOF'
+#include <stdint.h>
+
+#include "nano_sha3_256.h"
+
+extern uint32_t _stack_top;
+void reset_handler(void);
+
+__attribute__((section(".vector_table"), used))
+const void *const vector_table[2] = { &_stack_top, (const void *)reset_handler };
+
+static const uint8_t message[3] = { 'a', 'b', 'c' };
+
+void reset_handler(void) {
+    uint8_t out[32];
+
+    nano_sha3_256(out, message, sizeof(message));
+    asm volatile ("" : : "r"(out) : "memory");
+    while (1);
+}
+EOF
+
+    if ! arm-none-eabi-gcc -mcpu=cortex-m7 -mthumb -mfloat-abi=hard -mfpu=fpv5-d16 -nostdlib -nostartfiles \
+        -ffreestanding -Os -I "${bench_dir}" -T "${bench_dir}/tcm.ld" \
+        "${bench_dir}/tcm.c" "${lib_path}" -o "${bench_dir}/tcm.elf" \
+        2>"${bench_dir}/tcm_compile.log"; then
+        echo "FAILED"
+        return 0
+    fi
+
+    # objdump -h: index, name, size, VMA, LMA, ...
+    local idx name size vma lma rest itcm=0 dtcm=0
+    while read -r idx name size vma lma rest; do
+        case "${name}" in
+            .itcm)
+                if (( 0x${size} > 0 && 0x${vma} < 0x00010000 && 0x${lma} >= 0x08000000 )); then itcm=1; fi ;;
+            .dtcm)
+                if (( 0x${size} > 0 && 0x${vma} >= 0x20000000 && 0x${vma} < 0x20020000 \
+                    && 0x${lma} >= 0x08000000 )); then dtcm=1; fi ;;
+        esac
+    done < <(arm-none-eabi-objdump -h "${bench_dir}/tcm.elf" 2>/dev/null)
+
+    if (( itcm && dtcm )); then
+        echo "PASSED"
+    else
+        echo "FAILED"
+    fi
+}
+
 # Build optimized binary for specific target
 build_optimized_binary() {
     local arch=$1
@@ -226,10 +918,15 @@ build_optimized_binary() {
     (
         cd "${project_dir}"
         
-        if [[ "${arch}" == "intel_x64" || "${arch}" == "arm_linux" ]]; then
+        if [[ "${arch}" == "intel_x64" || "${arch}" == "arm_linux" || "${arch}" == "aarch64" ]]; then
             # Linux targets: Build static library (.a file)
             log_info "Building C-compatible static library for ${arch}..."
-            cargo build --release --target "${target}"
+            if [[ "${arch}" == "arm_linux" ]]; then
+                # Unstable core::arch::arm NEON intrinsics (see src/lib.rs)
+                RUSTC_BOOTSTRAP=1 cargo build --release --target "${target}"
+            else
+                cargo build --release --target "${target}"
+            fi
             
             local static_lib="${project_dir}/target/${target}/release/libnano_sha3_256.a"
             
@@ -244,16 +941,47 @@ build_optimized_binary() {
                 
                 if [[ -f "${STATICLIBS_DIR}/${output_name}" ]]; then
                     log_info "✓ Created: ${STATICLIBS_DIR}/${output_name}"
-                    add_csv_result "${arch}" "${target}" "${file_size}" "SUCCESS" "C-compatible static library for timing validation"
+                    # intel_x64 with "counters": the NANO_SHA3_256_COUNTERS run of verify-nist.sh (not shipped)
+                    if [[ "${arch}" == "intel_x64" ]] && cargo build --release --target "${target}" \
+                        --features counter_cycles --target-dir target/counters; then
+                        mkdir -p "${STATICLIBS_DIR}/counters"
+                        cp "target/counters/${target}/release/libnano_sha3_256.a" "${STATICLIBS_DIR}/counters/${output_name}"
+                        log_info "✓ Created: ${STATICLIBS_DIR}/counters/${output_name} (validation only)"
+                    fi
+                    # intel_x64 on the cortex_*_fast bit-interleaved kernel: its host NIST run in verify-nist.sh (not shipped)
+                    if [[ "${arch}" == "intel_x64" ]] && cargo build --release --target "${target}" \
+                        --no-default-features --features interleaved --target-dir target/interleaved; then
+                        mkdir -p "${STATICLIBS_DIR}/interleaved"
+                        cp "target/interleaved/${target}/release/libnano_sha3_256.a" "${STATICLIBS_DIR}/interleaved/${output_name}"
+                        log_info "✓ Created: ${STATICLIBS_DIR}/interleaved/${output_name} (validation only)"
+                    fi
+                    # intel_x64 on the unroll profile kernels (scalar backend, 1 / 2 / 24 rounds
+                    # per loop): their host NIST run and ns/hash in verify-nist.sh (not shipped)
+                    if [[ "${arch}" == "intel_x64" ]]; then
+                        local unroll unroll_features
+                        for unroll in "${PROFILE_UNROLLS[@]}"; do
+                            unroll_features="scalar"
+                            [[ "${unroll}" != "1" ]] && unroll_features="scalar unroll${unroll}"
+                            if cargo build --release --target "${target}" --no-default-features \
+                                --features "${unroll_features}" --target-dir "target/unroll${unroll}"; then
+                                mkdir -p "${STATICLIBS_DIR}/unroll"
+                                cp "target/unroll${unroll}/${target}/release/libnano_sha3_256.a" \
+                                    "${STATICLIBS_DIR}/unroll/libnano_sha3_256_${arch}_unroll${unroll}.a"
+                                log_info "✓ Created: ${STATICLIBS_DIR}/unroll/libnano_sha3_256_${arch}_unroll${unroll}.a (validation only)"
+                            fi
+                        done
+                    fi
+                    local sponge_bytes=$(measure_sponge_permute_bytes "${static_lib}")
+                    add_csv_result "${arch}" "${target}" "${file_size}" "N/A" "N/A" "SUCCESS" "C-compatible static library for timing validation" "N/A" "N/A" "${sponge_bytes}"
                     return 0
                 else
                     log_error "✗ Failed to create: ${STATICLIBS_DIR}/${output_name}"
-                    add_csv_result "${arch}" "${target}" "${file_size}" "COPY_FAILED" "Failed to copy static library"
+                    add_csv_result "${arch}" "${target}" "${file_size}" "N/A" "N/A" "COPY_FAILED" "Failed to copy static library"
                     return 1
                 fi
             else
                 log_error "✗ Static library not found: ${static_lib}"
-                add_csv_result "${arch}" "${target}" "0" "BUILD_FAILED" "Static library build failed"
+                add_csv_result "${arch}" "${target}" "0" "N/A" "N/A" "BUILD_FAILED" "Static library build failed"
                 return 1
             fi
         else
@@ -267,13 +995,32 @@ build_optimized_binary() {
             
             if [[ -f "${binary}" ]]; then
                 # Get actual loadable size (.text + .data sections only)
-                local size_bytes=$(size -A -d "${binary}" 2>/dev/null | awk '/\.text|\.data/ {s+=$2} END{print s}')
+                # (.ramfunc, .itcm and .dtcm are copied from flash at startup, so they count too)
+                local size_bytes=$(size -A -d "${binary}" 2>/dev/null | awk '/\.text|\.data|\.ramfunc|\.itcm|\.dtcm/ {s+=$2} END{print s}')
                 
                 if [[ -n "${size_bytes}" && "${size_bytes}" -gt 0 ]]; then
                     log_info "✓ ${arch} binary: ${size_bytes} bytes (.text + .data)"
                     
                     # Check against size target
-                    if [[ ${size_bytes} -le ${size_target} ]]; then
+                    if [[ "${arch}" == *_fast ]]; then
+                        local status="SUCCESS"
+                        local notes="Bit-interleaved speed variant (opt-level 3)"
+                    elif [[ "${arch}" == *_ram ]]; then
+                        local status="SUCCESS"
+                        local notes="Bit-interleaved permutation and round constants in .ramfunc (opt-level 3)"
+                    elif [[ "${arch}" == *_tcm ]]; then
+                        local status="SUCCESS"
+                        local notes="Bit-interleaved permutation in .itcm and round constants in .dtcm (opt-level 3)"
+                    elif [[ "${arch}" == *_mve ]]; then
+                        local status="SUCCESS"
+                        local notes="Helium (MVE) variant: one-shot on the bit-interleaved kernel (opt-level 3)"
+                    elif [[ "${arch}" == *_asm && ${size_bytes} -le ${size_target} ]]; then
+                        local status="SUCCESS"
+                        local notes="Thumb-1 assembly permutation, meets ${size_target}B target"
+                    elif [[ "${arch}" == *_lowram && ${size_bytes} -le ${size_target} ]]; then
+                        local status="SUCCESS"
+                        local notes="In-place low-RAM variant, meets ${size_target}B target"
+                    elif [[ ${size_bytes} -le ${size_target} ]]; then
                         log_info "✓ ${arch} meets size target (${size_bytes} ≤ ${size_target} bytes)"
                         local status="SUCCESS"
                         local notes="Advanced nightly optimization, meets ${size_target}B target"
@@ -283,6 +1030,33 @@ build_optimized_binary() {
                         local notes="Advanced nightly optimization, exceeds ${size_target}B target"
                     fi
                     
+                    # Cycles/byte of the C API library under QEMU
+                    local capi_lib="${project_dir}/target/${target}/release/libnano_sha3_256_capi.a"
+                    local cycles_per_byte=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 0)
+                    local cycles_per_byte_unaligned=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 1)
+                    local cycles_per_block=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 0 8160 136)
+                    # lowram is sized for the streaming API on a caller-owned context
+                    local stack_api="all"
+                    [[ "${arch}" == *_lowram ]] && stack_api="stream"
+                    local stack_bytes=$(measure_stack_bytes "${target}" "${capi_lib}" "${project_dir}/bench" "${stack_api}")
+                    local sponge_bytes=$(measure_sponge_permute_bytes "${capi_lib}")
+                    log_info "✓ ${arch} cycles/byte: ${cycles_per_byte} aligned, ${cycles_per_byte_unaligned} unaligned, ${cycles_per_block} cycles/block, ${stack_bytes} B stack"
+                    log_info "✓ ${arch} sponge permutation: ${sponge_bytes} B flash"
+                    # tcm: link against the README's ITCM / DTCM script fragment
+                    if [[ "${arch}" == *_tcm ]]; then
+                        local tcm_link=$(check_tcm_link "${capi_lib}" "${project_dir}/bench")
+                        log_info "✓ ${arch} README TCM linker script: ${tcm_link}"
+                        notes="${notes}; README TCM linker script: ${tcm_link}"
+                        [[ "${tcm_link}" == "FAILED" ]] && status="TCM_LINK_FAILED"
+                    fi
+                    # Helium: nano_sha3_256_x4 on four messages, per byte of all four
+                    if [[ "${arch}" == *_mve ]]; then
+                        local x4_cycles_per_byte=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 0 8192 1 4)
+                        local x4_cycles_per_byte_unaligned=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 1 8192 1 4)
+                        local x4_cycles_per_block=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 0 8160 136 4)
+                        log_info "✓ ${arch} nano_sha3_256_x4 cycles/byte: ${x4_cycles_per_byte} aligned, ${x4_cycles_per_byte_unaligned} unaligned, ${x4_cycles_per_block} cycles/block"
+                    fi
+                    
                     # Copy to staticlibs directory with .a extension for compatibility
                     mkdir -p "${STATICLIBS_DIR}"
                     local output_name="libnano_sha3_256_${arch}.a"
@@ -290,11 +1064,14 @@ build_optimized_binary() {
                     
                     if [[ -f "${STATICLIBS_DIR}/${output_name}" ]]; then
                         log_info "✓ Created: ${STATICLIBS_DIR}/${output_name}"
-                        add_csv_result "${arch}" "${target}" "${size_bytes}" "${status}" "${notes}"
+                        add_csv_result "${arch}" "${target}" "${size_bytes}" "${cycles_per_byte}" "${cycles_per_byte_unaligned}" "${status}" "${notes}" "${stack_bytes}" "${cycles_per_block}" "${sponge_bytes}"
+                        if [[ "${arch}" == *_mve ]]; then
+                            add_csv_result "${arch}_x4" "${target}" "${size_bytes}" "${x4_cycles_per_byte}" "${x4_cycles_per_byte_unaligned}" "${status}" "nano_sha3_256_x4 on the MVE kernel: cycles per byte of 4 messages" "N/A" "${x4_cycles_per_block}"
+                        fi
                         return 0
                     else
                         log_error "✗ Failed to create: ${STATICLIBS_DIR}/${output_name}"
-                        add_csv_result "${arch}" "${target}" "${size_bytes}" "COPY_FAILED" "Failed to copy optimized binary"
+                        add_csv_result "${arch}" "${target}" "${size_bytes}" "${cycles_per_byte}" "${cycles_per_byte_unaligned}" "COPY_FAILED" "Failed to copy optimized binary"
                         return 1
                     fi
                 else
@@ -306,22 +1083,173 @@ build_optimized_binary() {
                     local output_name="libnano_sha3_256_${arch}.a"
                     cp "${binary}" "${STATICLIBS_DIR}/${output_name}"
                     
-                    add_csv_result "${arch}" "${target}" "${file_size}" "SIZE_FALLBACK" "Used file size, could not measure .text+.data"
+                    add_csv_result "${arch}" "${target}" "${file_size}" "N/A" "N/A" "SIZE_FALLBACK" "Used file size, could not measure .text+.data"
                     return 0
                 fi
             else
                 log_error "✗ Binary not found: ${binary}"
-                add_csv_result "${arch}" "${target}" "0" "BUILD_FAILED" "Nightly build failed to generate binary"
+                add_csv_result "${arch}" "${target}" "0" "N/A" "N/A" "BUILD_FAILED" "Nightly build failed to generate binary"
                 return 1
             fi
         fi
     )
 }
 
+# Standalone project for one unroll profile variant
+# Same layout as the cortex_*_fast projects: no core crate, the C API on
+# ffi/scalar.rs, a minimal binary for flash and a staticlib for QEMU.
+create_profile_project() {
+    local project_dir=$1
+    local opt_level=$2
+    local unroll=$3
+    local features='"scalar"'
+    if [[ "${unroll}" != "1" ]]; then
+        features='"scalar", "unroll'"${unroll}"'"'
+    fi
+    local opt_value="${opt_level}"
+    if [[ "${opt_level}" != [0-9] ]]; then
+        opt_value="\"${opt_level}\""
+    fi
+
+    mkdir -p "${project_dir}/src"
+    cat > "${project_dir}/Cargo.toml" << EOF
+[package]
+name = "nano_sha3_256_profile"
+version = "0.1.0"
+edition = "2021"
+
+[features]
+default = [${features}]
+interleaved = []         # Bit-interleaved speed variant (cortex_*_fast only)
+dispatch = []            # Runtime CPU dispatch of the permutation (intel_x64, aarch64)
+scalar = []              # Scalar sponge context, no core crate (unroll profile builds)
+unroll2 = []             # Permutation loop runs two rounds per iteration
+unroll24 = []            # Permutation fully unrolled (24 straight-line rounds)
+lowram = []              # In-place permutation, state only in the context (cortex_m0_lowram only)
+asm_m0 = []              # Thumb-1 assembly permutation under "interleaved" (cortex_m0_asm only)
+helium = []              # Helium (MVE) 4-lane kernel for nano_sha3_256_x4 (cortex_m55_mve only)
+ramfunc = []             # Permutation + constants in .ramfunc / .ramfunc.rodata (cortex_m4_ram)
+tcm = []                 # Permutation + constants in .itcm / .dtcm (Cortex-M7 TCMs)
+counters = []            # Hot-path counters + nano_sha3_256_get_counters (off by default)
+counter_cycles = ["counters"]  # Counters also accumulate rdtsc / DWT->CYCCNT cycles
+
+[[bin]]
+name = "nano_sha3_256_profile"
+path = "main.rs"
+
+# C API static library linked by the QEMU benchmarks
+[lib]
+name = "nano_sha3_256_capi"
+path = "src/lib.rs"
+crate-type = ["staticlib"]
+
+[profile.release]
+opt-level = ${opt_value}
+lto = true               # Link-time optimization
+codegen-units = 1        # Single codegen unit for better optimization
+panic = "abort"          # Abort on panic for smaller binaries
+strip = true             # Strip debug symbols
+EOF
+
+    cat > "${project_dir}/main.rs" << 'EOF'
+#![no_std]
+#![no_main]
+
+#[path = "src/ffi/mod.rs"]
+mod ffi;
+
+#[panic_handler]
+fn panic(_info: &core::panic::PanicInfo) -> ! {
+    loop {}
+}
+
+#[no_mangle]
+pub extern "C" fn _start() -> ! {
+    // Call SHA3-256 function to ensure it's included in binary
+    let input = b"test";
+    let mut hash = [0u8; 32];
+    unsafe { ffi::nano_sha3_256(hash.as_mut_ptr(), input.as_ptr(), input.len()) };
+    loop {}
+}
+EOF
+
+    cat > "${project_dir}/src/lib.rs" << 'EOF'
+#![no_std]
+
+// Full C API (one-shot + streaming) on the scalar sponge
+mod ffi;
+
+#[panic_handler]
+fn panic(_info: &core::panic::PanicInfo) -> ! {
+    loop {}
+}
+EOF
+    rm -rf "${project_dir}/src/ffi"
+    cp -r "${FFI_DIR}" "${project_dir}/src/ffi"
+}
+
+# Build and measure one (core, opt-level, unroll) point of the matrix
+# Variants are measurement points only, staticlibs/ keeps the shipped libraries.
+build_profile_variant() {
+    local arch=$1
+    local target=$2
+    local opt_level=$3
+    local unroll=$4
+    local name="${arch}-opt_${opt_level}-unroll${unroll}"
+    local project_dir="${BUILD_DIR}/profiles/${name}"
+
+    log_build "Building profile ${name} (${target})..."
+    create_profile_project "${project_dir}" "${opt_level}" "${unroll}"
+
+    if ! (cd "${project_dir}" && RUSTC_BOOTSTRAP=1 cargo +nightly build --release --target "${target}" \
+            -Z build-std=core \
+            -Z build-std-features=compiler-builtins-mem); then
+        log_error "✗ Profile ${name} failed to build"
+        add_csv_result "${name}" "${target}" "0" "N/A" "N/A" "BUILD_FAILED" "Unroll profile build failed" "N/A" "N/A"
+        return 1
+    fi
+
+    local binary="${project_dir}/target/${target}/release/nano_sha3_256_profile"
+    local capi_lib="${project_dir}/target/${target}/release/libnano_sha3_256_capi.a"
+    local size_bytes=$(size -A -d "${binary}" 2>/dev/null | awk '/\.text|\.data/ {s+=$2} END{print s+0}')
+    local stack_bytes=$(measure_stack_bytes "${target}" "${capi_lib}" "${project_dir}/bench")
+    local cycles_per_byte=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 0)
+    local cycles_per_byte_unaligned=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 1)
+    local cycles_per_block=$(measure_cycles_per_byte "${target}" "${capi_lib}" "${project_dir}/bench" 0 8160 136)
+    local sponge_bytes=$(measure_sponge_permute_bytes "${capi_lib}")
+
+    log_info "✓ ${name}: ${size_bytes} B flash, ${stack_bytes} B stack, ${cycles_per_block} cycles/block"
+    add_csv_result "${name}" "${target}" "${size_bytes}" "${cycles_per_byte}" "${cycles_per_byte_unaligned}" "SUCCESS" \
+        "Unroll profile: opt-level ${opt_level} ${unroll} round(s) per loop iteration" "${stack_bytes}" "${cycles_per_block}" "${sponge_bytes}"
+    return 0
+}
+
+# Every embedded core in TARGETS x PROFILE_OPT_LEVELS x PROFILE_UNROLLS
+build_profile_matrix() {
+    local arch opt_level unroll
+    local built=0 failed=0
+
+    log_build "=== Building Unroll Profile Matrix ==="
+    for arch in "${PROFILE_ARCHS[@]}"; do
+        # Cores left out of TARGETS are left out of the matrix too
+        [[ -n "${TARGETS[$arch]:-}" ]] || continue
+        for opt_level in "${PROFILE_OPT_LEVELS[@]}"; do
+            for unroll in "${PROFILE_UNROLLS[@]}"; do
+                if build_profile_variant "${arch}" "${TARGETS[$arch]}" "${opt_level}" "${unroll}"; then
+                    built=$((built + 1))
+                else
+                    failed=$((failed + 1))
+                fi
+            done
+        done
+    done
+    log_info "Profile variants: ${built} built, ${failed} failed"
+}
+
 # Initialize CSV results file
 init_csv() {
     mkdir -p "${RESULTS_DIR}"
-    echo "architecture,target,flash_size_bytes,status,notes" > "${CSV_FILE}"
+    echo "architecture,target,flash_size_bytes,stack_bytes,cycles_per_byte,cycles_per_byte_unaligned,cycles_per_block,sponge_permute_bytes,status,notes" > "${CSV_FILE}"
 }
 
 # Add result to CSV
@@ -329,17 +1257,22 @@ add_csv_result() {
     local arch=$1
     local target=$2
     local flash_size=$3
-    local status=$4
-    local notes=$5
+    local cycles_per_byte=$4
+    local cycles_per_byte_unaligned=$5
+    local status=$6
+    local notes=$7
+    local stack_bytes=${8:-N/A}
+    local cycles_per_block=${9:-N/A}
+    local sponge_bytes=${10:-N/A}
     
-    echo "${arch},${target},${flash_size},${status},${notes}" >> "${CSV_FILE}"
+    echo "${arch},${target},${flash_size},${stack_bytes},${cycles_per_byte},${cycles_per_byte_unaligned},${cycles_per_block},${sponge_bytes},${status},${notes}" >> "${CSV_FILE}"
 }
 
 # Build all optimized binaries
 build_all() {
     log_build "=== Building Multi-Architecture Static Libraries ==="
     log_info "Embedded targets: ARM Cortex processors (size optimization)"
-    log_info "Linux targets: Intel x86_64 + ARM Linux (timing validation)"
+    log_info "Linux targets: Intel x86_64 + ARM Linux + AArch64 (timing validation)"
     log_info "Optimization: Nightly Rust + build-std for embedded, standard for Linux"
     log_info "Strategy: Standalone projects with architecture-specific optimization"
     echo ""
@@ -362,6 +1295,11 @@ build_all() {
         echo ""
     done
     
+    if [[ "${BUILD_PROFILE_MATRIX}" != "0" ]]; then
+        build_profile_matrix
+        echo ""
+    fi
+    
     # Generate evidence documentation
     generate_evidence
     
@@ -415,9 +1353,69 @@ cargo build --release --target "\${target}"
 
 **Features:**
 - **C-compatible API**: \`extern "C"\` functions for direct C linking
+- **Streaming C API**: \`nano_sha3_256_init/update/final\` from \`ci-evidence/ffi/\` (caller-allocated context)
+- **Multi-buffer kernels**: \`nano_sha3_256_x4/_x8\` (AVX2/AVX-512) on x86_64, \`nano_sha3_256_x2\` (ARMv8.2-SHA3 on aarch64, NEON on arm_linux), runtime-detected
+- **Dispatched single-message permutation**: intel_x64 (scalar / BMI2 / AVX-512) and aarch64 (scalar / ARMv8.2-SHA3) build \`ffi/dispatch.rs\` instead of the core crate, so \`nano_sha3_256\`, the streaming API and SHAKE/KMAC run on the best kernel for the CPU
 - **Static library output**: \`crate-type = ["staticlib"]\` for .a files
 - **Performance optimization**: \`opt-level="3"\` for timing accuracy
-- **Cross-compilation**: Intel x86_64 + ARM Linux support
+- **Cross-compilation**: Intel x86_64 + ARM Linux + AArch64 support
+
+### Speed Variants (cortex_m4_fast, cortex_m33_fast)
+- **Kernel**: Bit-interleaved 32-bit lanes (\`ci-evidence/ffi/interleaved.rs\`), straight-line rounds, chi on BIC
+- **Profile**: \`opt-level=3\` with the same nightly build-std flow, no core crate dependency
+- **Trade-off**: Larger flash for fewer cycles; pick per product from the table below
+
+### Assembly Variant (cortex_m0_asm, BUILD_UNVALIDATED=1 only)
+- **Status**: Not shipped; built only with \`BUILD_UNVALIDATED=1\` until an on-target NIST run and the flash / cycles comparison below are committed
+- **Kernel**: Hand-written Thumb-1 Keccak-f[1600] (\`ci-evidence/ffi/armv6m.rs\`, cargo feature \`asm_m0\`) on bit-interleaved 32-bit lanes; the interleaved.rs context and sponge stay in Rust
+- **Scheduling**: Eight low registers only: theta parities and D in an 80-byte frame, Rho + Pi in place along the pi cycle with theta folded in, chi looped over the rows (108 B of permutation stack, 1008 B of code)
+- **Compare**: Flash and cycles/block against the Rust-generated \`cortex_m0\` row (also in arm-qemu-evidence.md)
+- **Profile**: \`opt-level="z"\` for the Rust glue, same nightly build-std flow, no core crate dependency
+
+### Low-RAM Variant (cortex_m0_lowram)
+- **Kernel**: In-place Keccak-f[1600] (\`ci-evidence/ffi/lowram.rs\`): theta XORed into the columns, Rho + Pi as one cycle with a single word in flight, chi row by row with two saved words
+- **State**: Only in the caller's \`nano_sha3_256_ctx\`; input XORed straight into it, \`nano_sha3_256_final\` squeezes in place (no block buffer, no state copy on the stack)
+- **Target**: ≤200 B worst-case stack for \`init\` / \`update\` / \`final\` on a static or task-owned context (the Stack column of this row); the one-shot adds its own 208 B context on top
+- **Profile**: \`opt-level="z"\`, same nightly build-std flow, no core crate dependency
+
+### Helium Variant (cortex_m55_mve, BUILD_UNVALIDATED=1 only)
+- **Status**: Not shipped; built only with \`BUILD_UNVALIDATED=1\` until a NIST run on the MPS3 AN547 machine and the \`cortex_m55_mve_x4\` cycles/byte row below are committed
+- **Target**: \`thumbv8m.main-none-eabihf\` with \`-C target-cpu=cortex-m55\` (rustc has no \`thumbv8.1m.main\` target; the CPU enables MVE and the FPU)
+- **Kernel**: 4 Keccak states in MVE q registers (\`ci-evidence/ffi/helium.rs\`, cargo feature \`helium\`), bit-interleaved so every rotate is on 32-bit elements; \`nano_sha3_256_x4\` and \`nano_sha3_256_node64_many\` run on it
+- **Single stream**: \`nano_sha3_256\` and the streaming API keep the bit-interleaved scalar kernel (row \`cortex_m55_mve\`); one state has no 4-wide parallelism
+- **Compare**: Row \`cortex_m55_mve_x4\` (cycles per byte of each of 4 messages) against the scalar \`cortex_m33\` and \`cortex_m33_fast\` rows
+- **Caveat**: Instruction counts; Cortex-M55 retires a 128-bit MVE instruction in two beats (M85: one), so silicon cycles sit above the x4 figure on M55
+- **Harness**: Enables CP10/CP11 in CPACR before the first call, runs on the MPS3 AN547 (Cortex-M55) QEMU machine
+
+### RAM-Resident Variant (cortex_m4_ram)
+- **Kernel**: The cortex_m4_fast build with cargo feature \`ramfunc\`: the permutation lands in \`.ramfunc\` and its round constants in \`.ramfunc.rodata\`, copied from flash to SRAM by the startup code (\`*(.ramfunc*)\` in the \`.data\` output section of the firmware's linker script)
+- **TCM**: Feature \`tcm\` instead puts them in \`.itcm\` / \`.dtcm\` for Cortex-M7 parts; the integrator's script maps those to ITCM / DTCM with load addresses in flash
+- **TCM build**: \`cortex_m7_tcm\` (\`thumbv7em-none-eabihf\`) is that variant; its C API library is linked with the README's script fragment on a Cortex-M7 map (ITCM 0x00000000, flash 0x08000000, DTCM 0x20000000), and its Notes say whether .itcm and .dtcm landed in the TCMs with flash load addresses (status \`TCM_LINK_FAILED\` otherwise)
+- **Why**: At 168-480 MHz, fetches from flash add wait states whenever the ART accelerator or I-cache misses; SRAM and TCM fetches run at zero wait states
+- **Compare**: Cycles/block of cortex_m4_ram and cortex_m7_tcm next to the flash-resident cortex_m4_fast row in the table below (the same kernel; the M7 row runs on the MPS2 AN500 machine, which has no TCMs, so its sections sit in SRAM). QEMU models no wait states, so there all rows give the same instruction count; on a board the gap is the flash stall time, read with \`DWT->CYCCNT\` by the verify-arm-qemu.sh harness
+- **Cost**: The RAM column is SRAM taken by the copied code and tables; the flash image is unchanged (the copy's load image stays in flash). Calls from flash reach RAM through linker-generated long-branch veneers
+
+### Unroll Profile Matrix (\`<core>-opt_<level>-unroll<n>\` rows)
+- **Cores**: ${PROFILE_ARCHS[*]}, each at opt-level ${PROFILE_OPT_LEVELS[*]} and ${PROFILE_UNROLLS[*]} round(s) per permutation loop iteration
+- **Kernel**: Scalar sponge (\`ci-evidence/ffi/scalar.rs\`) on the lane-generic permutation (\`ci-evidence/ffi/keccak.rs\`), unrolling picked by the \`unroll2\` / \`unroll24\` cargo features (none = fully looped)
+- **Measured**: flash (.text + .data), peak stack of the one-shot and streaming API (painted stack under QEMU), cycles/byte and cycles per 136-byte block
+- **Use**: Measurement points, not shipped libraries; rebuild the chosen point with the same features and opt-level
+- **Skip**: \`BUILD_PROFILE_MATRIX=0\`
+
+## Cycle Measurement
+- **Method**: QEMU \`libinsn\` plugin instruction count, empty vs 8 KB message, difference / 8192
+- **Alignment**: Measured with the message 8-byte aligned and 1 byte off; aligned blocks take the whole-word absorb path
+- **Model**: One instruction taken as one cycle on single-issue Cortex-M (lower bound on silicon)
+- **Cycles/block**: Same method on a 60-block (8160-byte) message, difference / 60
+- **Stack**: RAM between .bss and the harness stack pointer painted, one-shot + streaming hash of 300 bytes, deepest overwritten word reported over semihosting
+- **Availability**: \`N/A\` when arm-none-eabi-gcc, qemu-system-arm or the plugin is missing (set \`QEMU_PLUGIN_DIR\`)
+
+## Sponge Permutation
+- **Column**: Flash of the SHAKE / cSHAKE / KMAC sponge's own permutation entry (\`nm --print-size\` on the C API library), already part of the Flash Size column
+- **intel_x64, cortex_m0_lowram**: 0; the sponge calls the backend's permutation
+- **cortex_*_fast, cortex_m4_ram, cortex_m0_asm, cortex_m55_mve**: The lane-conversion wrapper round the bit-interleaved permutation
+- **cortex_m0, cortex_m4, cortex_m33**: A second, 64-bit Keccak-f[1600] next to the core crate's (the core exposes no permutation); this is what SHAKE / KMAC add to those cores
+- **Unroll rows**: The scalar backend's only permutation, shared with SHA3-256
 
 ## Size Targets
 - **Embedded flash footprint**: 1.5KB (.text + .data sections)
@@ -428,8 +1426,12 @@ cargo build --release --target "\${target}"
 - **Cortex-M0**: Ultra-low-power applications, smallest flash budgets
 - **Cortex-M4**: Performance embedded applications, most common MCU
 - **Cortex-M33**: TrustZone security applications, modern embedded
+- **Cortex-M4/M33 fast**: Cycle-bound paths such as secure-boot image verification
+- **Cortex-M4/M7 RAM**: The same on parts whose flash adds wait states (permutation in .ramfunc, or in the TCMs with \`tcm\`)
+- **Cortex-M55/M85 MVE**: Several streams at once (Merkle levels, multi-image verification) on Helium
 - **Intel x86_64**: Native timing validation with cycle-accurate measurements
 - **ARM Linux**: Cross-architecture timing validation with QEMU user-mode emulation
+- **AArch64**: Edge gateway class cores (Cortex-A76, Graviton), EOR3/RAX1/XAR/BCAX kernel where FEAT_SHA3 is present
 
 ## Build Results
 EOF
@@ -437,12 +1439,53 @@ EOF
     # Add results from CSV
     if [[ -f "${CSV_FILE}" ]]; then
         echo "" >> "${EVIDENCE_FILE}"
-        echo "| Architecture | Target | Flash Size | Status | Notes |" >> "${EVIDENCE_FILE}"
-        echo "|--------------|--------|------------|--------|-------|" >> "${EVIDENCE_FILE}"
+        echo "| Architecture | Target | Flash Size | Stack | Cycles/Byte | Cycles/Byte (unaligned) | Cycles/Block | Sponge Permutation | Status | Notes |" >> "${EVIDENCE_FILE}"
+        echo "|--------------|--------|------------|-------|-------------|-------------------------|--------------|--------------------|--------|-------|" >> "${EVIDENCE_FILE}"
         
         # Skip header line and format results
-        tail -n +2 "${CSV_FILE}" | while IFS=',' read -r arch target flash_size status notes; do
-            echo "| ${arch} | ${target} | ${flash_size} B | ${status} | ${notes} |" >> "${EVIDENCE_FILE}"
+        tail -n +2 "${CSV_FILE}" | while IFS=',' read -r arch target flash_size stack_bytes cycles_per_byte cycles_per_byte_unaligned cycles_per_block sponge_bytes status notes; do
+            echo "| ${arch} | ${target} | ${flash_size} B | ${stack_bytes} | ${cycles_per_byte} | ${cycles_per_byte_unaligned} | ${cycles_per_block} | ${sponge_bytes} B | ${status} | ${notes} |" >> "${EVIDENCE_FILE}"
+        done
+    fi
+
+    # Helium x4 against the scalar Cortex-M33 builds (cycles/byte, same harness)
+    if [[ -f "${CSV_FILE}" ]] && grep -q "^cortex_m55_mve_x4," "${CSV_FILE}"; then
+        local cpb_x4=$(awk -F',' '$1 == "cortex_m55_mve_x4" { print $5 }' "${CSV_FILE}")
+        echo "" >> "${EVIDENCE_FILE}"
+        echo "### Helium vs Scalar Cortex-M33" >> "${EVIDENCE_FILE}"
+        echo "" >> "${EVIDENCE_FILE}"
+        echo "| Scalar build | Cycles/Byte | cortex_m55_mve_x4 Cycles/Byte | Ratio |" >> "${EVIDENCE_FILE}"
+        echo "|--------------|-------------|-------------------------------|-------|" >> "${EVIDENCE_FILE}"
+        local base
+        for base in cortex_m33 cortex_m33_fast cortex_m55_mve; do
+            local cpb=$(awk -F',' -v a="${base}" '$1 == a { print $5 }' "${CSV_FILE}")
+            local ratio=$(awk -v s="${cpb}" -v v="${cpb_x4}" 'BEGIN { if (s + 0 > 0 && v + 0 > 0) printf "%.2fx", s / v; else print "N/A" }')
+            echo "| ${base} | ${cpb:-N/A} | ${cpb_x4} | ${ratio} |" >> "${EVIDENCE_FILE}"
+        done
+    fi
+
+    # RAM / TCM-resident permutation next to the flash-resident build
+    if [[ -f "${CSV_FILE}" ]] && grep -qE "^cortex_m(4_ram|7_tcm)," "${CSV_FILE}"; then
+        echo "" >> "${EVIDENCE_FILE}"
+        echo "### Flash vs RAM-Resident Permutation (Cortex-M4 / M7)" >> "${EVIDENCE_FILE}"
+        echo "" >> "${EVIDENCE_FILE}"
+        echo "| Build | Permutation in | Flash | RAM (.ramfunc / TCM) | Cycles/Block (0 wait states) |" >> "${EVIDENCE_FILE}"
+        echo "|-------|----------------|-------|----------------------|------------------------------|" >> "${EVIDENCE_FILE}"
+        local build
+        for build in cortex_m4_fast cortex_m4_ram cortex_m7_tcm; do
+            grep -q "^${build}," "${CSV_FILE}" || continue
+            local flash=$(awk -F',' -v a="${build}" '$1 == a { print $3 }' "${CSV_FILE}")
+            local cpb=$(awk -F',' -v a="${build}" '$1 == a { print $7 }' "${CSV_FILE}")
+            local where="flash" ram_bytes=0
+            local binary="${BUILD_DIR}/${build}/target/${TARGETS[$build]}/release/nano_sha3_256_${build}"
+            if [[ "${build}" == *_ram ]]; then
+                where="SRAM (.ramfunc)"
+                ram_bytes=$(size -A -d "${binary}" 2>/dev/null | awk '/\.ramfunc/ {s+=$2} END{print s+0}')
+            elif [[ "${build}" == *_tcm ]]; then
+                where="ITCM (.itcm) + DTCM (.dtcm)"
+                ram_bytes=$(size -A -d "${binary}" 2>/dev/null | awk '/\.[id]tcm/ {s+=$2} END{print s+0}')
+            fi
+            echo "| ${build} | ${where} | ${flash:-N/A} B | ${ram_bytes} B | ${cpb:-N/A} |" >> "${EVIDENCE_FILE}"
         done
     fi
 
@@ -563,9 +1606,19 @@ usage() {
     echo "    - ARM Cortex-M0  (thumbv6m-none-eabi) - 1.5KB target"
     echo "    - ARM Cortex-M4  (thumbv7em-none-eabi) - 1.5KB target"
     echo "    - ARM Cortex-M33 (thumbv8m.main-none-eabi) - 1.5KB target"
+    echo "  Embedded (Speed Optimization):"
+    echo "    - ARM Cortex-M4/M33 fast variants - bit-interleaved, opt-level 3"
+    echo "    - ARM Cortex-M0 low-RAM variant - in-place permutation, ≤200 B stack"
+    echo "  Embedded (Unvalidated, BUILD_UNVALIDATED=1 to build; not shipped):"
+    echo "    - ARM Cortex-M0 assembly variant - Thumb-1 interleaved permutation"
+    echo "    - ARM Cortex-M55/M85 Helium variant - MVE 4-lane kernel"
+    echo "  Embedded (Unroll Profile Matrix, BUILD_PROFILE_MATRIX=0 to skip):"
+    echo "    - Cortex-M0/M4/M33 x opt-level z/s/3 x 1/2/24 rounds per loop"
+    echo "      (flash, stack, cycles/block in build-results.csv; not shipped)"
     echo "  Linux (Timing Validation):"
     echo "    - Intel x86_64   (x86_64-unknown-linux-gnu) - C-compatible .a"
     echo "    - ARM Linux      (armv7-unknown-linux-gnueabihf) - C-compatible .a"
+    echo "    - AArch64 Linux  (aarch64-unknown-linux-gnu) - C-compatible .a"
     echo ""
     echo "Optimization Features:"
     echo "  - Embedded: Nightly Rust + build-std for maximum size reduction"
@@ -0,0 +1,173 @@
+#!/bin/bash
+# NanoSHA3-256 Multi-Buffer Throughput Validation
+# Measures nano_sha3_256_x4 (AVX2) and nano_sha3_256_x8 (AVX-512) against
+# sequential nano_sha3_256() calls on the intel_x64 static library
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+RESULTS_DIR="${SCRIPT_DIR}/../results"
+LOG_FILE="${RESULTS_DIR}/multibuf-validation.log"
+CSV_FILE="${RESULTS_DIR}/multibuf-results.csv"
+EVIDENCE_FILE="${RESULTS_DIR}/multibuf-evidence.md"
+STATICLIBS_DIR="${SCRIPT_DIR}/staticlibs"
+HEADER_FILE="${SCRIPT_DIR}/nano_sha3_256.h"
+STATIC_LIB="libnano_sha3_256_intel_x64.a"
+TEST_DIR="${RESULTS_DIR}/multibuf_test_intel_x64"
+
+mkdir -p "${RESULTS_DIR}"
+
+echo "🚀 NanoSHA3-256 Multi-Buffer Throughput Validation"
+echo "=================================================="
+
+if [ ! -f "${STATICLIBS_DIR}/${STATIC_LIB}" ]; then
+    echo "❌ Static library not found: ${STATIC_LIB}. Run verify-build-staticlibs.sh first."
+    exit 1
+fi
+
+mkdir -p "${TEST_DIR}"
+cp "${HEADER_FILE}" "${TEST_DIR}/"
+
+# Throughput benchmark: short records, one message per lane
+cat > "${TEST_DIR}/multibuf_bench.c" << 'EOF'
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "nano_sha3_256.h"
+
+#define MESSAGES (1u << 18)
+#define MAX_LEN 200
+
+static const size_t RECORD_SIZES[] = {32, 64, 136, 200};
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void) {
+    static uint8_t input[8][MAX_LEN];
+    static uint8_t digest[8][32];
+    uint8_t *out[8];
+    const uint8_t *in[8];
+    size_t len[8];
+
+    for (int l = 0; l < 8; l++) {
+        for (int i = 0; i < MAX_LEN; i++) {
+            input[l][i] = (uint8_t)(i * 31 + l);
+        }
+        out[l] = digest[l];
+        in[l] = input[l];
+    }
+
+    // Lanes must agree with the scalar path before anything is timed
+    for (size_t s = 0; s < sizeof(RECORD_SIZES) / sizeof(RECORD_SIZES[0]); s++) {
+        uint8_t expected[32];
+        for (int l = 0; l < 8; l++) {
+            len[l] = RECORD_SIZES[s];
+        }
+        nano_sha3_256_x8(out, in, len);
+        for (int l = 0; l < 8; l++) {
+            nano_sha3_256(expected, input[l], RECORD_SIZES[s]);
+            if (memcmp(expected, digest[l], 32) != 0) {
+                printf("FAIL: x8 lane %d differs from scalar at %zu bytes\n", l, RECORD_SIZES[s]);
+                return 1;
+            }
+        }
+    }
+
+    printf("record_bytes,api,lanes,messages,seconds,mb_per_sec,ns_per_message\n");
+    for (size_t s = 0; s < sizeof(RECORD_SIZES) / sizeof(RECORD_SIZES[0]); s++) {
+        size_t size = RECORD_SIZES[s];
+        for (int l = 0; l < 8; l++) {
+            len[l] = size;
+        }
+
+        for (int api = 0; api < 3; api++) {
+            const int lanes = api == 0 ? 1 : (api == 1 ? 4 : 8);
+            const char *name = api == 0 ? "nano_sha3_256" : (api == 1 ? "nano_sha3_256_x4" : "nano_sha3_256_x8");
+
+            double start = now_sec();
+            for (uint32_t m = 0; m < MESSAGES; m += lanes) {
+                if (api == 0) {
+                    nano_sha3_256(digest[0], input[m & 7], size);
+                } else if (api == 1) {
+                    nano_sha3_256_x4(out, in, len);
+                } else {
+                    nano_sha3_256_x8(out, in, len);
+                }
+            }
+            double elapsed = now_sec() - start;
+
+            printf("%zu,%s,%d,%u,%.6f,%.2f,%.2f\n", size, name, lanes, MESSAGES, elapsed,
+                   (double)MESSAGES * size / elapsed / 1e6, elapsed * 1e9 / MESSAGES);
+        }
+    }
+    return 0;
+}
+EOF
+
+echo "🔨 Compiling multi-buffer benchmark..."
+if ! gcc -O2 -Wall -Wextra -std=c99 -o "${TEST_DIR}/multibuf_bench" \
+    "${TEST_DIR}/multibuf_bench.c" "${STATICLIBS_DIR}/${STATIC_LIB}" 2>>"${LOG_FILE}"; then
+    echo "❌ Compilation failed (see ${LOG_FILE})"
+    exit 1
+fi
+
+CPU_MODEL=$(grep -m1 "model name" /proc/cpuinfo 2>/dev/null | cut -d: -f2 | sed 's/^ //' || echo "unknown")
+CPU_FLAGS=$(grep -m1 "^flags" /proc/cpuinfo 2>/dev/null || echo "")
+AVX2=$(echo "${CPU_FLAGS}" | grep -qw avx2 && echo "yes" || echo "no")
+AVX512=$(echo "${CPU_FLAGS}" | grep -qw avx512f && echo "yes" || echo "no")
+
+echo "🏃 Running on ${CPU_MODEL} (AVX2: ${AVX2}, AVX-512F: ${AVX512})..."
+if ! "${TEST_DIR}/multibuf_bench" > "${CSV_FILE}" 2>>"${LOG_FILE}"; then
+    echo "❌ Multi-buffer benchmark failed"
+    cat "${CSV_FILE}" | tee -a "${LOG_FILE}"
+    echo "FAILED" > "${RESULTS_DIR}/multibuf-status.txt"
+    exit 1
+fi
+cat "${CSV_FILE}" | tee -a "${LOG_FILE}"
+
+# Generate evidence
+cat > "${EVIDENCE_FILE}" << EOF
+# Multi-Buffer Throughput Evidence
+
+## Validation Method
+- **Approach**: Sequential \`nano_sha3_256()\` vs \`nano_sha3_256_x4()\` / \`nano_sha3_256_x8()\`
+- **Library**: ${STATIC_LIB}
+- **CPU**: ${CPU_MODEL}
+- **AVX2**: ${AVX2} (4-way kernel)
+- **AVX-512F**: ${AVX512} (8-way kernel)
+- **Messages**: 262,144 per measurement, record sizes 32/64/136/200 bytes
+- **Correctness**: Every x8 lane compared against scalar digest before timing
+- **Timestamp**: $(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+## Results
+
+| Record | API | Lanes | MB/s | ns/message |
+|--------|-----|-------|------|------------|
+EOF
+
+tail -n +2 "${CSV_FILE}" | while IFS=',' read -r size api lanes messages seconds mbps nspm; do
+    echo "| ${size} B | ${api} | ${lanes} | ${mbps} | ${nspm} |" >> "${EVIDENCE_FILE}"
+done
+
+cat >> "${EVIDENCE_FILE}" << EOF
+
+## Notes
+- CPUs without AVX2 run the multi-buffer entry points on the scalar core,
+  so their numbers match sequential calls.
+- NIST correctness of every lane is covered by verify-nist.sh (x4 and x8 lane checks).
+EOF
+
+echo "ACHIEVED" > "${RESULTS_DIR}/multibuf-status.txt"
+
+echo ""
+echo "📋 Evidence generated:"
+echo "  - Results: ${CSV_FILE}"
+echo "  - Evidence: ${EVIDENCE_FILE}"
+echo "  - Status: ${RESULTS_DIR}/multibuf-status.txt"
+echo "  - Log: ${LOG_FILE}"
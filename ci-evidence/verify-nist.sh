@@ -16,6 +16,7 @@ RESULTS_DIR="${SCRIPT_DIR}/../results"
 LOG_FILE="${RESULTS_DIR}/nist-validation.log"
 
 mkdir -p "${RESULTS_DIR}"
+: > "${LOG_FILE}"
 
 echo "=== NIST SHA3-256 Static Library Validation ==="
 echo "Testing actual customer static libraries against 237 critical NIST CAVS vectors"
@@ -40,7 +41,7 @@ NIST_TEST_DIR="${RESULTS_DIR}/nist_test_intel_x64"
 mkdir -p "${NIST_TEST_DIR}"
 
 # Copy header and validator
-cp "${SCRIPT_DIR}/nano_sha3_256.h" "${NIST_TEST_DIR}/"
+cp "${SCRIPT_DIR}/nano_sha3_256.h" "${SCRIPT_DIR}/nano_sha3_256_inline.h" "${NIST_TEST_DIR}/"
 cp "${SCRIPT_DIR}/nist_validator.c" "${NIST_TEST_DIR}/"
 
 # Build and run Intel x64 NIST validator
@@ -66,6 +67,116 @@ else
     echo -e "${RED}✗ Intel x64 NIST validation: FAILED${NC}"
 fi
 
+# Counters build (verify-build-staticlibs.sh, not shipped): the same vectors
+# with NANO_SHA3_256_COUNTERS, so the larger context and check_counters run
+COUNTERS_LIB="${STATICLIBS_DIR}/counters/libnano_sha3_256_intel_x64.a"
+if [ -f "${COUNTERS_LIB}" ]; then
+    echo "  Building Intel x64 NIST validator against the counters library..."
+    gcc -O2 -Wall -Wextra -std=c99 -DNANO_SHA3_256_COUNTERS \
+        -o nist_validator_counters \
+        nist_validator.c \
+        "${COUNTERS_LIB}" \
+        2>&1 | tee -a "${LOG_FILE}"
+
+    if [ -f "nist_validator_counters" ] && ./nist_validator_counters 2>&1 | tee -a "${LOG_FILE}"; then
+        COUNTERS_STATUS="PASSED"
+    else
+        COUNTERS_STATUS="FAILED"
+    fi
+
+    # A context sized by the other header must not link against either library
+    MISMATCH_C='#include "nano_sha3_256.h"
+int main(void) { nano_sha3_256_ctx c; nano_sha3_256_init(&c); return 0; }'
+    if printf '%s\n' "${MISMATCH_C}" | gcc -std=c99 -I. -x c -o /dev/null - -x none "${COUNTERS_LIB}" >/dev/null 2>&1 ||
+        printf '%s\n' "${MISMATCH_C}" | gcc -std=c99 -DNANO_SHA3_256_COUNTERS -I. -x c -o /dev/null - -x none \
+            "${STATICLIBS_DIR}/libnano_sha3_256_intel_x64.a" >/dev/null 2>&1; then
+        COUNTERS_STATUS="FAILED"
+        echo -e "${RED}✗ Header/library counters mismatch links${NC}"
+    fi
+
+    if [ "${COUNTERS_STATUS}" = "PASSED" ]; then
+        echo -e "${GREEN}✓ Intel x64 counters NIST validation: PASSED (mismatched header fails to link)${NC}"
+    else
+        INTEL_STATUS="FAILED"
+        echo -e "${RED}✗ Intel x64 counters NIST validation: FAILED${NC}"
+    fi
+else
+    COUNTERS_STATUS="SKIPPED"
+    echo -e "${YELLOW}⚠ Intel x64 counters NIST validation: SKIPPED (${COUNTERS_LIB} not built)${NC}"
+fi
+
+# Bit-interleaved kernel of the cortex_*_fast / _ram / _tcm libraries, built
+# for the host (verify-build-staticlibs.sh, not shipped): the same vectors on
+# the same Rust source, without the Cortex-M code generation
+INTERLEAVED_LIB="${STATICLIBS_DIR}/interleaved/libnano_sha3_256_intel_x64.a"
+if [ -f "${INTERLEAVED_LIB}" ]; then
+    echo "  Building Intel x64 NIST validator against the bit-interleaved kernel..."
+    gcc -O2 -Wall -Wextra -std=c99 -DNANO_SHA3_256_SINGLE_KERNEL \
+        -o nist_validator_interleaved \
+        nist_validator.c \
+        "${INTERLEAVED_LIB}" \
+        2>&1 | tee -a "${LOG_FILE}"
+
+    if [ -f "nist_validator_interleaved" ] && ./nist_validator_interleaved 2>&1 | tee -a "${LOG_FILE}"; then
+        INTERLEAVED_STATUS="PASSED"
+        echo -e "${GREEN}✓ Intel x64 bit-interleaved kernel NIST validation: PASSED${NC}"
+    else
+        INTERLEAVED_STATUS="FAILED"
+        INTEL_STATUS="FAILED"
+        echo -e "${RED}✗ Intel x64 bit-interleaved kernel NIST validation: FAILED${NC}"
+    fi
+else
+    INTERLEAVED_STATUS="SKIPPED"
+    echo -e "${YELLOW}⚠ Intel x64 bit-interleaved kernel NIST validation: SKIPPED (${INTERLEAVED_LIB} not built)${NC}"
+fi
+
+# Unroll profile kernels (scalar backend at 1 / 2 / 24 rounds per loop),
+# built for the host by verify-build-staticlibs.sh: every vector, plus the
+# Monte Carlo ns/hash of each so the unroll levels compare on this CPU
+UNROLL_STATUS="SKIPPED"
+UNROLL_RESULTS=""
+shopt -s nullglob
+UNROLL_LIBS=("${STATICLIBS_DIR}"/unroll/libnano_sha3_256_intel_x64_unroll*.a)
+shopt -u nullglob
+for lib in "${UNROLL_LIBS[@]}"; do
+    unroll=$(basename "${lib}" .a)
+    unroll=${unroll##*_unroll}
+    echo "  Building Intel x64 NIST validator against the unroll${unroll} scalar kernel..."
+    gcc -O2 -Wall -Wextra -std=c99 -DNANO_SHA3_256_SINGLE_KERNEL \
+        -o "nist_validator_unroll${unroll}" \
+        nist_validator.c \
+        "${lib}" \
+        2>&1 | tee -a "${LOG_FILE}"
+
+    if [ -f "nist_validator_unroll${unroll}" ] && ./"nist_validator_unroll${unroll}" > "unroll${unroll}.out" 2>&1; then
+        [ "${UNROLL_STATUS}" = "FAILED" ] || UNROLL_STATUS="PASSED"
+        ns=$(sed -n 's/^  Monte Carlo: .*(\([0-9.]*\) ns\/hash.*/\1/p' "unroll${unroll}.out")
+        UNROLL_RESULTS="${UNROLL_RESULTS}${UNROLL_RESULTS:+, }unroll${unroll} ${ns:-?} ns/hash"
+        echo -e "${GREEN}✓ Intel x64 unroll${unroll} kernel NIST validation: PASSED (${ns:-?} ns/hash)${NC}"
+    else
+        UNROLL_STATUS="FAILED"
+        INTEL_STATUS="FAILED"
+        UNROLL_RESULTS="${UNROLL_RESULTS}${UNROLL_RESULTS:+, }unroll${unroll} FAILED"
+        echo -e "${RED}✗ Intel x64 unroll${unroll} kernel NIST validation: FAILED${NC}"
+    fi
+    cat "unroll${unroll}.out" >> "${LOG_FILE}"
+    rm -f "unroll${unroll}.out"
+done
+if [ ${#UNROLL_LIBS[@]} -eq 0 ]; then
+    echo -e "${YELLOW}⚠ Intel x64 unroll kernels NIST validation: SKIPPED (${STATICLIBS_DIR}/unroll not built)${NC}"
+fi
+
+# The header-only implementation must also build warning-free as C++
+if command -v g++ >/dev/null 2>&1; then
+    if printf '#include "nano_sha3_256_inline.h"\nint main() { unsigned char d[32] = {0}; nano_sha3_256_inline(d, d, 32); return d[0]; }\n' |
+        g++ -std=c++11 -O2 -Wall -Wextra -Werror -x c++ -o /dev/null - 2>&1 | tee -a "${LOG_FILE}"; then
+        echo -e "${GREEN}✓ nano_sha3_256_inline.h builds as C++11${NC}"
+    else
+        INTEL_STATUS="FAILED"
+        echo -e "${RED}✗ nano_sha3_256_inline.h does not build as C++11${NC}"
+    fi
+fi
+
 # Test ARM Linux static library (additional validation)
 echo ""
 echo "🔬 Testing ARM Linux static library..."
@@ -73,7 +184,7 @@ NIST_TEST_ARM_DIR="${RESULTS_DIR}/nist_test_arm_linux"
 mkdir -p "${NIST_TEST_ARM_DIR}"
 
 # Copy header and validator
-cp "${SCRIPT_DIR}/nano_sha3_256.h" "${NIST_TEST_ARM_DIR}/"
+cp "${SCRIPT_DIR}/nano_sha3_256.h" "${SCRIPT_DIR}/nano_sha3_256_inline.h" "${NIST_TEST_ARM_DIR}/"
 cp "${SCRIPT_DIR}/nist_validator.c" "${NIST_TEST_ARM_DIR}/"
 
 cd "${NIST_TEST_ARM_DIR}"
@@ -110,6 +221,52 @@ else
     echo -e "${YELLOW}⚠ ARM Linux NIST validation: SKIPPED (arm-linux-gnueabihf-gcc not available)${NC}"
 fi
 
+# Test AArch64 static library (ARMv8.2-SHA3 kernel)
+echo ""
+echo "🔬 Testing AArch64 static library..."
+NIST_TEST_A64_DIR="${RESULTS_DIR}/nist_test_aarch64"
+mkdir -p "${NIST_TEST_A64_DIR}"
+
+# Copy header and validator
+cp "${SCRIPT_DIR}/nano_sha3_256.h" "${SCRIPT_DIR}/nano_sha3_256_inline.h" "${NIST_TEST_A64_DIR}/"
+cp "${SCRIPT_DIR}/nist_validator.c" "${NIST_TEST_A64_DIR}/"
+
+cd "${NIST_TEST_A64_DIR}"
+
+if [ ! -f "${STATICLIBS_DIR}/libnano_sha3_256_aarch64.a" ]; then
+    AARCH64_STATUS="SKIPPED"
+    echo -e "${YELLOW}⚠ AArch64 NIST validation: SKIPPED (libnano_sha3_256_aarch64.a not built)${NC}"
+elif command -v aarch64-linux-gnu-gcc >/dev/null 2>&1; then
+    echo "  Building AArch64 NIST validator (cross-compile)..."
+    aarch64-linux-gnu-gcc -O2 -Wall -Wextra -std=c99 \
+        -o nist_validator_aarch64 \
+        nist_validator.c \
+        "${STATICLIBS_DIR}/libnano_sha3_256_aarch64.a" \
+        2>&1 | tee -a "${LOG_FILE}"
+    
+    if [ -f "nist_validator_aarch64" ]; then
+        echo "  Running AArch64 NIST validation (QEMU user-mode, -cpu max for FEAT_SHA3)..."
+        if command -v qemu-aarch64 >/dev/null 2>&1; then
+            if qemu-aarch64 -cpu max -L /usr/aarch64-linux-gnu ./nist_validator_aarch64 2>&1 | tee -a "${LOG_FILE}"; then
+                AARCH64_STATUS="PASSED"
+                echo -e "${GREEN}✓ AArch64 NIST validation: PASSED${NC}"
+            else
+                AARCH64_STATUS="FAILED"
+                echo -e "${RED}✗ AArch64 NIST validation: FAILED${NC}"
+            fi
+        else
+            AARCH64_STATUS="SKIPPED"
+            echo -e "${YELLOW}⚠ AArch64 NIST validation: SKIPPED (qemu-aarch64 not available)${NC}"
+        fi
+    else
+        AARCH64_STATUS="BUILD_FAILED"
+        echo -e "${RED}✗ AArch64 NIST validation: BUILD FAILED${NC}"
+    fi
+else
+    AARCH64_STATUS="SKIPPED"
+    echo -e "${YELLOW}⚠ AArch64 NIST validation: SKIPPED (aarch64-linux-gnu-gcc not available)${NC}"
+fi
+
 # Generate comprehensive evidence
 cat > "${RESULTS_DIR}/nist-evidence.md" << EOF
 # NIST SHA3-256 Static Library Validation Evidence
@@ -123,7 +280,15 @@ cat > "${RESULTS_DIR}/nist-evidence.md" << EOF
 ## Test Coverage
 - **ShortMsg**: 137 vectors (algorithm correctness)
 - **LongMsg**: 100 vectors (large input handling)
-- **Monte Carlo**: Excluded (not applicable to one-shot API)
+- **Streaming API**: Every vector re-hashed via \`nano_sha3_256_init/update/final\` in 1/7/136/137-byte chunks
+- **Header-only**: Every vector re-hashed by \`nano_sha3_256_inline.h\` one-shot and chunked, plus a second Monte Carlo chain; the header is also built as C++11
+- **Scatter-gather API**: Every vector re-hashed via \`nano_sha3_256_v\`, split into up to 64 fragments of pseudo-random length (0-299 bytes, empty fragments included) so rate blocks straddle fragment boundaries
+- **Midstate API**: Every vector re-hashed from a \`nano_sha3_256_prefix\` midstate over its first half, and again from a \`nano_sha3_256_clone\` of it
+- **DMA ping-pong API**: Every vector fed through a simulated circular DMA buffer in 136-, 200- and 272-byte halves (\`nano_sha3_256_dma_*\`)
+- **SHAKE128/SHAKE256**: CAVS-layout ShortMsg/LongMsg/VariableOut files (\`test_data_nist/SHAKE*.rsp\`, 456 vectors) via one-shot and chunked absorb/squeeze, plus the 4-way absorb/squeezeblocks API on the multi-buffer libraries
+- **KMAC256**: SP 800-185 KMAC samples #4-#6 plus generated vectors (\`test_data_nist/KMAC256.rsp\`) from a reused keyed context and a cloned, chunked one
+- **ParallelHash256**: SP 800-185 samples #4-#6 plus generated vectors (\`test_data_nist/ParallelHash256.rsp\`) on 1, 3 and all cores (Linux libraries)
+- **Monte Carlo**: SHA3VS chained test (\`test_data_nist/SHA3_256Monte.rsp\`, 100 checkpoints x 1000 hashes) on one reused streaming context, with its sustained ns/hash in the log
 
 ## Validation Results
 
@@ -132,13 +297,25 @@ cat > "${RESULTS_DIR}/nist-evidence.md" << EOF
 - **Status**: ${INTEL_STATUS}
 - **Architecture**: x86_64-unknown-linux-gnu
 - **Compiler**: gcc with -O2 optimization
+- **Counters build**: ${COUNTERS_STATUS} (\`counters/libnano_sha3_256_intel_x64.a\`, \`-DNANO_SHA3_256_COUNTERS\`: all vectors on the 400-byte context plus the counter checks; a header/library mismatch fails to link)
+- **Bit-interleaved kernel (host)**: ${INTERLEAVED_STATUS} (\`interleaved/libnano_sha3_256_intel_x64.a\`, the ffi/interleaved.rs kernel of the cortex_*_fast / _ram / _tcm libraries built for x86_64; checks the Rust source, not the Thumb-2 code generation)
+- **Unroll profile kernels (host)**: ${UNROLL_STATUS} (\`unroll/libnano_sha3_256_intel_x64_unroll{1,2,24}.a\`, the scalar backend of the profile matrix; Monte Carlo on x86_64: ${UNROLL_RESULTS:-not run}; Cortex-M flash, stack and cycles/block come from the matrix rows of build-results.csv)
 
 ### ARM Linux Static Library
 - **Library**: ${STATICLIBS_DIR}/libnano_sha3_256_arm_linux.a
 - **Status**: ${ARM_STATUS}
 - **Architecture**: armv7-unknown-linux-gnueabihf
+- **Multi-buffer**: \`nano_sha3_256_x2\` on the NEON 2-way kernel
 - **Execution**: $([ "${ARM_STATUS}" = "PASSED" ] && echo "QEMU user-mode emulation" || echo "Cross-compilation attempted")
 
+### AArch64 Static Library
+- **Library**: ${STATICLIBS_DIR}/libnano_sha3_256_aarch64.a
+- **Status**: ${AARCH64_STATUS}
+- **Architecture**: aarch64-unknown-linux-gnu
+- **Multi-buffer**: \`nano_sha3_256_x2\` on the ARMv8.2-SHA3 kernel (EOR3/RAX1/XAR/BCAX)
+- **Single-message path**: every vector on each dispatched kernel (scalar, sha3), plus context checkpoints
+- **Execution**: $([ "${AARCH64_STATUS}" = "PASSED" ] && echo "QEMU user-mode emulation (-cpu max)" || echo "Cross-compilation attempted")
+
 ## Professional Assessment
 This validation tests the actual static libraries that customers receive,
 ensuring complete consistency between validation and deployment. The C-based
@@ -154,6 +331,7 @@ EOF
 echo "architecture,library,status,vectors_tested" > "${RESULTS_DIR}/nist-results.csv"
 echo "intel_x64,libnano_sha3_256_intel_x64.a,${INTEL_STATUS},237" >> "${RESULTS_DIR}/nist-results.csv"
 echo "arm_linux,libnano_sha3_256_arm_linux.a,${ARM_STATUS},237" >> "${RESULTS_DIR}/nist-results.csv"
+echo "aarch64,libnano_sha3_256_aarch64.a,${AARCH64_STATUS},237" >> "${RESULTS_DIR}/nist-results.csv"
 
 # Create status file
 if [ "${INTEL_STATUS}" = "PASSED" ]; then
@@ -0,0 +1,293 @@
+#!/bin/bash
+# NanoSHA3-256 nano-sha3sum CLI Validation
+# Builds the nano-sha3sum file hashing tool against the intel_x64 and
+# arm_linux static libraries, checks its digests against an independent
+# SHA3-256 and publishes bytes/sec for mapped files, pipes and -j runs over
+# many files, next to OpenSSL and sha3sum on the same files
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+RESULTS_DIR="${SCRIPT_DIR}/../results"
+LOG_FILE="${RESULTS_DIR}/sha3sum-validation.log"
+CSV_FILE="${RESULTS_DIR}/sha3sum-results.csv"
+EVIDENCE_FILE="${RESULTS_DIR}/sha3sum-evidence.md"
+STATICLIBS_DIR="${SCRIPT_DIR}/staticlibs"
+TOOL_SOURCE="${SCRIPT_DIR}/nano_sha3sum.c"
+
+# Benchmark file size, override with SHA3SUM_BENCH_MB
+BENCH_MB="${SHA3SUM_BENCH_MB:-512}"
+
+# Many-file run: file count and size, override with SHA3SUM_MANY_FILES /
+# SHA3SUM_MANY_MB
+MANY_FILES="${SHA3SUM_MANY_FILES:-64}"
+MANY_MB="${SHA3SUM_MANY_MB:-8}"
+
+mkdir -p "${RESULTS_DIR}"
+: > "${LOG_FILE}"
+
+echo "🧮 NanoSHA3-256 nano-sha3sum CLI Validation"
+echo "==========================================="
+
+WORK_DIR=$(mktemp -d "${TMPDIR:-/tmp}/nano-sha3sum.XXXXXX")
+trap 'rm -rf "${WORK_DIR}"' EXIT
+
+# Reference digests: Python hashlib, else OpenSSL
+reference_sha3() {
+    if command -v python3 >/dev/null 2>&1; then
+        python3 -c 'import hashlib, sys; print(hashlib.sha3_256(open(sys.argv[1], "rb").read()).hexdigest())' "$1"
+    else
+        openssl dgst -sha3-256 -r "$1" | cut -d' ' -f1
+    fi
+}
+
+# Sizes around the rate (136), the mmap threshold (64 KiB) and the mapping window (68 MiB)
+CHECK_SIZES=(0 1 135 136 137 65535 65536 1114112 1114113 71303168 71303305)
+echo "📝 Generating ${#CHECK_SIZES[@]} check files..."
+for size in "${CHECK_SIZES[@]}"; do
+    head -c "${size}" /dev/urandom > "${WORK_DIR}/check_${size}.bin"
+done
+
+# Correctness: mapped / read path per file, stdin pipe, and one -j run over all files
+check_tool() {
+    local label="$1"
+    shift
+    local run=("$@")
+    local failed=0
+
+    for size in "${CHECK_SIZES[@]}"; do
+        local file="${WORK_DIR}/check_${size}.bin"
+        local expected
+        expected=$(reference_sha3 "${file}")
+        local mapped piped
+        mapped=$("${run[@]}" "${file}" | cut -d' ' -f1) || true
+        piped=$(cat "${file}" | "${run[@]}" | cut -d' ' -f1) || true
+        if [[ "${mapped}" != "${expected}" || "${piped}" != "${expected}" ]]; then
+            echo "  ✗ ${label}: ${size} bytes (file ${mapped:-error}, pipe ${piped:-error}, expected ${expected})" | tee -a "${LOG_FILE}"
+            failed=1
+        fi
+    done
+
+    local files=()
+    for size in "${CHECK_SIZES[@]}"; do
+        files+=("${WORK_DIR}/check_${size}.bin")
+    done
+    local serial concurrent
+    serial=$("${run[@]}" -j 1 "${files[@]}") || true
+    concurrent=$("${run[@]}" -j 4 "${files[@]}") || true
+    if [[ "${serial}" != "${concurrent}" ]]; then
+        echo "  ✗ ${label}: -j 4 output differs from -j 1" | tee -a "${LOG_FILE}"
+        failed=1
+    fi
+
+    if "${run[@]}" "${WORK_DIR}/missing.bin" >/dev/null 2>>"${LOG_FILE}"; then
+        echo "  ✗ ${label}: missing file did not fail" | tee -a "${LOG_FILE}"
+        failed=1
+    fi
+
+    if [[ ${failed} -eq 0 ]]; then
+        echo "  ✓ ${label}: ${#CHECK_SIZES[@]} sizes via mmap/read and pipe, -j output order" | tee -a "${LOG_FILE}"
+    fi
+    return ${failed}
+}
+
+# Wall-clock seconds of a command, output discarded
+time_run() {
+    local start end
+    start=$(date +%s%N)
+    "$@" > /dev/null
+    end=$(date +%s%N)
+    echo "$(( end - start ))" | awk '{ printf "%.6f", $1 / 1e9 }'
+}
+
+add_result() {
+    local arch="$1" mode="$2" files="$3" bytes="$4" seconds="$5"
+    awk -v a="${arch}" -v m="${mode}" -v f="${files}" -v b="${bytes}" -v s="${seconds}" \
+        'BEGIN { printf "%s,%s,%s,%s,%s,%.0f,%.2f\n", a, m, f, b, s, b / s, b / s / 1e6 }' >> "${CSV_FILE}"
+}
+
+echo "arch,mode,files,bytes,seconds,bytes_per_sec,mb_per_sec" > "${CSV_FILE}"
+INTEL_STATUS="SKIPPED"
+ARM_STATUS="SKIPPED"
+JOBS=$(nproc 2>/dev/null || echo 1)
+BENCH_BYTES=$(( BENCH_MB * 1024 * 1024 ))
+# Jobs for the many-file run, at least 4 so the worker pool is exercised
+# even on a one-core host (override with SHA3SUM_JOBS)
+MANY_JOBS="${SHA3SUM_JOBS:-$(( JOBS > 4 ? JOBS : 4 ))}"
+MANY_STATUS="SKIPPED"
+
+# Intel x64: native build, correctness and throughput
+echo ""
+echo "🔨 Building nano-sha3sum for intel_x64..."
+INTEL_TOOL="${RESULTS_DIR}/sha3sum_intel_x64/nano-sha3sum"
+mkdir -p "$(dirname "${INTEL_TOOL}")"
+if [ ! -f "${STATICLIBS_DIR}/libnano_sha3_256_intel_x64.a" ]; then
+    echo "❌ Static library not found: libnano_sha3_256_intel_x64.a. Run verify-build-staticlibs.sh first."
+    exit 1
+fi
+if ! gcc -O2 -Wall -Wextra -std=c99 -pthread -I"${SCRIPT_DIR}" -o "${INTEL_TOOL}" \
+    "${TOOL_SOURCE}" "${STATICLIBS_DIR}/libnano_sha3_256_intel_x64.a" 2>>"${LOG_FILE}"; then
+    echo "❌ Compilation failed (see ${LOG_FILE})"
+    exit 1
+fi
+
+echo "🔍 Checking digests..."
+if check_tool "intel_x64" "${INTEL_TOOL}"; then
+    INTEL_STATUS="PASSED"
+else
+    INTEL_STATUS="FAILED"
+fi
+
+echo "🏃 Measuring throughput on a ${BENCH_MB} MiB file (page cache warm)..."
+BENCH_FILE="${WORK_DIR}/bench.bin"
+head -c "${BENCH_BYTES}" /dev/urandom > "${BENCH_FILE}"
+cat "${BENCH_FILE}" > /dev/null
+
+# Ceiling for the tool: page-cache read bandwidth with no hashing at all
+add_result "intel_x64" "cat (no hash)" 1 "${BENCH_BYTES}" "$(time_run cat "${BENCH_FILE}")"
+add_result "intel_x64" "mmap" 1 "${BENCH_BYTES}" "$(time_run "${INTEL_TOOL}" "${BENCH_FILE}")"
+add_result "intel_x64" "pipe" 1 "${BENCH_BYTES}" \
+    "$(time_run sh -c 'cat "$1" | "$2"' sh "${BENCH_FILE}" "${INTEL_TOOL}")"
+
+# -j: one copy of the file per job, concurrently
+BENCH_FILES=()
+for (( i = 0; i < JOBS; i++ )); do
+    BENCH_FILES+=("${BENCH_FILE}")
+done
+add_result "intel_x64" "mmap -j ${JOBS}" "${JOBS}" "$(( BENCH_BYTES * JOBS ))" \
+    "$(time_run "${INTEL_TOOL}" -j "${JOBS}" "${BENCH_FILES[@]}")"
+
+# Many distinct files: nano-sha3sum -j 1 and -j MANY_JOBS against OpenSSL
+# and sha3sum, serially and one process per file under xargs -P MANY_JOBS
+echo "🏃 Measuring ${MANY_FILES} x ${MANY_MB} MiB files, -j 1 and -j ${MANY_JOBS}..."
+MANY_BYTES=$(( MANY_FILES * MANY_MB * 1024 * 1024 ))
+MANY=()
+for (( i = 0; i < MANY_FILES; i++ )); do
+    MANY+=("${WORK_DIR}/many_${i}.bin")
+    head -c "$(( MANY_MB * 1024 * 1024 ))" /dev/urandom > "${MANY[i]}"
+done
+cat "${MANY[@]}" > /dev/null
+
+add_result "intel_x64" "cat (no hash; many files)" "${MANY_FILES}" "${MANY_BYTES}" "$(time_run cat "${MANY[@]}")"
+add_result "intel_x64" "mmap -j 1 (many files)" "${MANY_FILES}" "${MANY_BYTES}" "$(time_run "${INTEL_TOOL}" -j 1 "${MANY[@]}")"
+add_result "intel_x64" "mmap -j ${MANY_JOBS} (many files)" "${MANY_FILES}" "${MANY_BYTES}" \
+    "$(time_run "${INTEL_TOOL}" -j "${MANY_JOBS}" "${MANY[@]}")"
+
+# The baselines must print the same digests, in the same order
+"${INTEL_TOOL}" -j "${MANY_JOBS}" "${MANY[@]}" | cut -d' ' -f1 > "${WORK_DIR}/many.nano"
+if command -v openssl >/dev/null 2>&1 && openssl dgst -sha3-256 /dev/null >/dev/null 2>&1; then
+    MANY_STATUS="PASSED"
+    openssl dgst -sha3-256 -r "${MANY[@]}" | cut -d' ' -f1 > "${WORK_DIR}/many.openssl"
+    if ! cmp -s "${WORK_DIR}/many.nano" "${WORK_DIR}/many.openssl"; then
+        echo "  ✗ intel_x64: ${MANY_FILES}-file -j ${MANY_JOBS} digests differ from openssl dgst" | tee -a "${LOG_FILE}"
+        MANY_STATUS="FAILED"
+    fi
+    add_result "intel_x64" "openssl dgst -sha3-256" "${MANY_FILES}" "${MANY_BYTES}" \
+        "$(time_run openssl dgst -sha3-256 -r "${MANY[@]}")"
+    add_result "intel_x64" "openssl dgst -sha3-256 (xargs -P ${MANY_JOBS})" "${MANY_FILES}" "${MANY_BYTES}" \
+        "$(time_run sh -c 'printf "%s\0" "$@" | xargs -0 -n 1 -P "$0" openssl dgst -sha3-256 -r' "${MANY_JOBS}" "${MANY[@]}")"
+fi
+if command -v sha3sum >/dev/null 2>&1; then
+    [[ "${MANY_STATUS}" == "SKIPPED" ]] && MANY_STATUS="PASSED"
+    sha3sum -a 256 "${MANY[@]}" | cut -d' ' -f1 > "${WORK_DIR}/many.sha3sum"
+    if ! cmp -s "${WORK_DIR}/many.nano" "${WORK_DIR}/many.sha3sum"; then
+        echo "  ✗ intel_x64: ${MANY_FILES}-file -j ${MANY_JOBS} digests differ from sha3sum" | tee -a "${LOG_FILE}"
+        MANY_STATUS="FAILED"
+    fi
+    add_result "intel_x64" "sha3sum -a 256" "${MANY_FILES}" "${MANY_BYTES}" \
+        "$(time_run sha3sum -a 256 "${MANY[@]}")"
+    add_result "intel_x64" "sha3sum -a 256 (xargs -P ${MANY_JOBS})" "${MANY_FILES}" "${MANY_BYTES}" \
+        "$(time_run sh -c 'printf "%s\0" "$@" | xargs -0 -n 1 -P "$0" sha3sum -a 256' "${MANY_JOBS}" "${MANY[@]}")"
+fi
+if [[ "${MANY_STATUS}" == "SKIPPED" ]]; then
+    echo "  ⚠ Neither openssl (with SHA3) nor sha3sum available, no baseline for the many-file run"
+fi
+rm -f "${MANY[@]}"
+
+# ARM Linux: cross build, correctness under QEMU user-mode (no throughput, emulated)
+echo ""
+echo "🔨 Building nano-sha3sum for arm_linux..."
+ARM_TOOL="${RESULTS_DIR}/sha3sum_arm_linux/nano-sha3sum"
+if [ ! -f "${STATICLIBS_DIR}/libnano_sha3_256_arm_linux.a" ]; then
+    echo "⚠ ARM Linux: SKIPPED (libnano_sha3_256_arm_linux.a not built)"
+elif ! command -v arm-linux-gnueabihf-gcc >/dev/null 2>&1; then
+    echo "⚠ ARM Linux: SKIPPED (arm-linux-gnueabihf-gcc not available)"
+else
+    mkdir -p "$(dirname "${ARM_TOOL}")"
+    if ! arm-linux-gnueabihf-gcc -O2 -Wall -Wextra -std=c99 -pthread -I"${SCRIPT_DIR}" -o "${ARM_TOOL}" \
+        "${TOOL_SOURCE}" "${STATICLIBS_DIR}/libnano_sha3_256_arm_linux.a" 2>>"${LOG_FILE}"; then
+        ARM_STATUS="BUILD_FAILED"
+        echo "✗ ARM Linux: BUILD FAILED (see ${LOG_FILE})"
+    elif ! command -v qemu-arm >/dev/null 2>&1; then
+        echo "⚠ ARM Linux: built, run SKIPPED (qemu-arm not available)"
+    elif check_tool "arm_linux" qemu-arm -L /usr/arm-linux-gnueabihf "${ARM_TOOL}"; then
+        ARM_STATUS="PASSED"
+    else
+        ARM_STATUS="FAILED"
+    fi
+fi
+
+echo ""
+cat "${CSV_FILE}" | tee -a "${LOG_FILE}"
+
+CPU_MODEL=$(grep -m1 "model name" /proc/cpuinfo 2>/dev/null | cut -d: -f2 | sed 's/^ //' || echo "unknown")
+
+# Generate evidence
+cat > "${EVIDENCE_FILE}" << EOF
+# nano-sha3sum CLI Evidence
+
+## Tool
+- **Source**: \`ci-evidence/nano_sha3sum.c\`, linked against libnano_sha3_256_intel_x64.a / libnano_sha3_256_arm_linux.a
+- **Regular files ≥ 64 KiB**: mapped in 68 MiB windows with \`MADV_SEQUENTIAL\`, hashed in place through \`nano_sha3_256_update\`
+- **Pipes and small files**: double-buffered 1,114,112-byte reads (8192 rate blocks), a reader thread fills one buffer while the other is hashed
+- **Concurrency**: \`-j JOBS\` worker threads (default one per CPU), digests printed in argument order
+- **Output**: \`<digest>  <name>\` (sha3sum -a 256 format)
+
+## Correctness
+- **Reference**: Python hashlib SHA3-256 (OpenSSL when Python is missing)
+- **Sizes**: ${CHECK_SIZES[*]} bytes, each as a file argument and through a pipe, plus one \`-j 4\` run over all of them
+- **intel_x64**: ${INTEL_STATUS}
+- **Many-file run**: ${MANY_STATUS} (\`-j ${MANY_JOBS}\` digests against \`openssl dgst -sha3-256\` / \`sha3sum -a 256\`, where installed)
+- **arm_linux (QEMU user-mode)**: ${ARM_STATUS}
+
+## Throughput (intel_x64)
+- **CPU**: ${CPU_MODEL} (${JOBS} online)
+- **File**: ${BENCH_MB} MiB of random data, page cache warm
+- **Many files**: ${MANY_FILES} distinct ${MANY_MB} MiB files of random data, page cache warm, \`-j 1\` and \`-j ${MANY_JOBS}\`
+- **Timestamp**: $(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+| Mode | Files | Bytes | Seconds | bytes/sec | MB/s |
+|------|-------|-------|---------|-----------|------|
+EOF
+
+tail -n +2 "${CSV_FILE}" | while IFS=',' read -r arch mode files bytes seconds bps mbps; do
+    echo "| ${mode} | ${files} | ${bytes} | ${seconds} | ${bps} | ${mbps} |" >> "${EVIDENCE_FILE}"
+done
+
+cat >> "${EVIDENCE_FILE}" << EOF
+
+## Notes
+- \`cat (no hash)\` is the page-cache read rate of the same file, the ceiling
+  a single-stream hasher can reach on this machine.
+- \`mmap -j\` aggregates all jobs; it scales with cores until memory
+  bandwidth, not the permutation, is the limit. With ${JOBS} online
+  core(s), \`-j ${MANY_JOBS}\` measures what the worker pool costs or wins
+  on this machine, not the scaling on a wider one.
+- OpenSSL and sha3sum rows hash the same ${MANY_FILES} files, once in a
+  single process and once one process per file under \`xargs -P ${MANY_JOBS}\`.
+EOF
+
+if [[ "${INTEL_STATUS}" == "PASSED" && "${MANY_STATUS}" != "FAILED" && "${ARM_STATUS}" != "FAILED" && "${ARM_STATUS}" != "BUILD_FAILED" ]]; then
+    echo "ACHIEVED" > "${RESULTS_DIR}/sha3sum-status.txt"
+else
+    echo "FAILED" > "${RESULTS_DIR}/sha3sum-status.txt"
+fi
+
+echo ""
+echo "📋 Evidence generated:"
+echo "  - Results: ${CSV_FILE}"
+echo "  - Evidence: ${EVIDENCE_FILE}"
+echo "  - Status: ${RESULTS_DIR}/sha3sum-status.txt"
+echo "  - Log: ${LOG_FILE}"
+
+[[ "$(cat "${RESULTS_DIR}/sha3sum-status.txt")" == "ACHIEVED" ]]
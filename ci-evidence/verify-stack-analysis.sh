@@ -25,8 +25,13 @@ declare -A TARGETS=(
     ["cortex_m0"]="thumbv6m-none-eabi"
     ["cortex_m4"]="thumbv7em-none-eabi" 
     ["cortex_m33"]="thumbv8m.main-none-eabi"
+    ["cortex_m4_fast"]="thumbv7em-none-eabi"
+    ["cortex_m33_fast"]="thumbv8m.main-none-eabi"
+    ["cortex_m0_lowram"]="thumbv6m-none-eabi"
+    ["cortex_m0_asm"]="thumbv6m-none-eabi"
     ["intel_x64"]="x86_64-unknown-linux-gnu"
     ["arm_linux"]="armv7-unknown-linux-gnueabihf"
+    ["aarch64"]="aarch64-unknown-linux-gnu"
 )
 
 # Cross-compiler prefixes for each architecture
@@ -34,8 +39,13 @@ declare -A CROSS_COMPILE=(
     ["cortex_m0"]="arm-none-eabi-"
     ["cortex_m4"]="arm-none-eabi-"
     ["cortex_m33"]="arm-none-eabi-"
+    ["cortex_m4_fast"]="arm-none-eabi-"
+    ["cortex_m33_fast"]="arm-none-eabi-"
+    ["cortex_m0_lowram"]="arm-none-eabi-"
+    ["cortex_m0_asm"]="arm-none-eabi-"
     ["intel_x64"]=""  # Native tools
     ["arm_linux"]="arm-linux-gnueabihf-"
+    ["aarch64"]="aarch64-linux-gnu-"
 )
 
 # Logging functions
@@ -244,6 +254,25 @@ EOF
         # Extract function names and their stack operations
         grep -B2 -A5 "sub.*sp" "${disasm_file}" | head -30 >> "${stack_analysis}" 2>/dev/null || true
         
+    elif [[ "${arch}" == "aarch64" ]]; then
+        # AArch64 patterns for stack allocation (the x2 kernel and the
+        # dispatched single-message sha3 kernel keep their 25-lane state in
+        # v0-v31, spills show up as sp-relative q stores)
+        grep -E "(sub.*sp, sp|stp.*\[sp|ldp.*\[sp|str.*q[0-9]+, \[sp)" "${disasm_file}" | head -20 >> "${stack_analysis}" 2>/dev/null || true
+        
+        cat >> "${stack_analysis}" << EOF
+
+## AArch64 Stack Patterns Detected
+- 'sub sp, sp, #N' instructions indicate stack frame allocation
+- 'stp x29, x30, [sp, #-N]!' saves frame pointer and link register
+- 'str qN, [sp, #N]' spills NEON state registers
+
+## Key Functions Identified
+EOF
+        
+        # Extract function names and their stack operations
+        grep -B2 -A5 "sub.*sp, sp" "${disasm_file}" | head -30 >> "${stack_analysis}" 2>/dev/null || true
+        
     else
         # x86_64 patterns for stack allocation
         grep -E "(sub.*rsp|push|pop)" "${disasm_file}" | head -20 >> "${stack_analysis}" 2>/dev/null || true
@@ -298,7 +327,7 @@ measure_actual_stack_usage() {
     log_info "Performing actual stack measurement for ${arch}..."
     
     # Skip measurement for architectures we can't easily build/analyze
-    if [[ "${arch}" == "arm_linux" ]]; then
+    if [[ "${arch}" == "arm_linux" || "${arch}" == "aarch64" ]]; then
         log_warn "Skipping actual measurement for ${arch} (requires cross-compilation setup)"
         echo "cross_compile_required"
         return 1
@@ -311,7 +340,42 @@ measure_actual_stack_usage() {
     mkdir -p "${test_project}/src"
     
     # Copy base harness files (create if doesn't exist)
-    if [[ -f "${harness_dir}/src/main.rs" ]]; then
+    if [[ "${arch}" == *_lowram ]]; then
+        # Low-RAM variant is sized for the streaming API on a context the
+        # caller owns (static here, a task or driver struct in products)
+        cat > "${test_project}/src/main.rs" << 'EOF'
+#![no_std]
+#![no_main]
+
+extern "C" {
+    fn nano_sha3_256_init(ctx: *mut [u64; 44]);
+    fn nano_sha3_256_update(ctx: *mut [u64; 44], input: *const u8, len: usize);
+    fn nano_sha3_256_final(ctx: *mut [u64; 44], out: *mut u8);
+}
+
+static mut CTX: [u64; 44] = [0; 44];
+static LARGE_INPUT: [u8; 1000] = [0; 1000];
+
+#[panic_handler]
+fn panic(_info: &core::panic::PanicInfo) -> ! {
+    loop {}
+}
+
+#[no_mangle]
+pub extern "C" fn _start() -> ! {
+    let mut output = [0u8; 32];
+    unsafe {
+        let ctx = core::ptr::addr_of_mut!(CTX);
+        nano_sha3_256_init(ctx);
+        // Unaligned split: byte-wise head, full-block lanes, byte-wise tail
+        nano_sha3_256_update(ctx, LARGE_INPUT.as_ptr(), 7);
+        nano_sha3_256_update(ctx, LARGE_INPUT.as_ptr().add(7), LARGE_INPUT.len() - 7);
+        nano_sha3_256_final(ctx, output.as_mut_ptr());
+    }
+    loop {}
+}
+EOF
+    elif [[ -f "${harness_dir}/src/main.rs" ]]; then
         cp "${harness_dir}/src/main.rs" "${test_project}/src/"
     else
         # Create the harness inline if template doesn't exist
@@ -608,7 +672,18 @@ generate_all_analysis() {
                 local measured_stack=$(echo "${analysis_result}" | cut -d'|' -f1)
                 local measurement_method=$(echo "${analysis_result}" | cut -d'|' -f2)
                 
-                add_csv_result "${arch}" "${TARGETS[$arch]}" "${lib_size}" "SUCCESS" "280-384" "${measured_stack}" "${measurement_method}" "${files_count}"
+                # Speed variants keep the 200 B interleaved state plus a
+                # 200 B Rho/Pi scratch array, outside the 384 B claim
+                local static_estimate="280-384"
+                [[ "${arch}" == *_fast ]] && static_estimate="640-800"
+                # Low-RAM variant: no block buffer and no second state,
+                # only theta parities and spills (streaming API)
+                [[ "${arch}" == *_lowram ]] && static_estimate="120-200"
+                # Assembly variant: interleaved context (340 B) plus the
+                # 108 B permutation frame
+                [[ "${arch}" == *_asm ]] && static_estimate="460-560"
+                
+                add_csv_result "${arch}" "${TARGETS[$arch]}" "${lib_size}" "SUCCESS" "${static_estimate}" "${measured_stack}" "${measurement_method}" "${files_count}"
             else
                 failed=$((failed + 1))
                 add_csv_result "${arch}" "${TARGETS[$arch]}" "${lib_size}" "FAILED" "unknown" "unknown" "analysis_failed" "0"
@@ -699,11 +774,20 @@ Where toolchain support allows, actual post-link measurements are performed usin
 3. **Post-Link Analysis**: cargo-call-stack or readelf analysis of final linked binary
 4. **Worst-Case Testing**: Multiple input sizes including 4KB maximum practical size
 
+**Low-RAM Variant (cortex_m0_lowram): 120-200 Bytes**
+Streaming API on a caller-owned context, in-place permutation (\`ci-evidence/ffi/lowram.rs\`):
+- **State Array**: 0 bytes on the stack (lives in the caller's \`nano_sha3_256_ctx\`, input XORed straight into it)
+- **Rate Buffer**: 0 bytes (no block staging; \`final\` squeezes from the context in place)
+- **Theta Parities**: 40 bytes (5 × 64-bit column words)
+- **Local Variables / Register Saves**: Rho/Pi carry word, two Chi row words, Thumb-1 register-pair spills
+- **Sizing**: Per-call budget for interrupt handlers and small RTOS task stacks; the one-shot \`nano_sha3_256\` adds its own 208-byte context on top
+
 ### Architecture-Specific Considerations
 - **ARM Cortex-M**: 8-byte stack alignment, efficient Thumb-2 instructions
 - **ARM Cortex-M0**: 8-byte alignment, Thumb-1 limitations may increase usage
 - **Intel x86_64**: 16-byte stack alignment, larger register saves
 - **ARM Linux**: Similar to Cortex but with Linux ABI considerations
+- **AArch64**: 16-byte stack alignment, x2 kernel state held in NEON registers
 
 ### Measurement Confidence Levels
 - **High Confidence**: Post-link measurement with cargo-call-stack
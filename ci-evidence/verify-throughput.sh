@@ -0,0 +1,321 @@
+#!/bin/bash
+# NanoSHA3-256 Throughput Benchmark
+# Cycles/byte and MB/s of one-shot vs streaming SHA3-256 for messages from
+# 0 B to 16 MB on the intel_x64 static library. Cycles come from rdtsc; the
+# previous run is kept so each drop is compared against the last one. x86_64
+# only: under QEMU user-mode the ARM Linux / AArch64 libraries would time the
+# emulator, and Cortex-M cycle counts need a bare-metal harness
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+RESULTS_DIR="${SCRIPT_DIR}/../results"
+LOG_FILE="${RESULTS_DIR}/throughput-validation.log"
+CSV_FILE="${RESULTS_DIR}/throughput-results.csv"
+PREVIOUS_CSV="${RESULTS_DIR}/throughput-previous.csv"
+EVIDENCE_FILE="${RESULTS_DIR}/throughput-evidence.md"
+STATICLIBS_DIR="${SCRIPT_DIR}/staticlibs"
+HEADER_FILE="${SCRIPT_DIR}/nano_sha3_256.h"
+ARCH="intel_x64"
+STATIC_LIB="libnano_sha3_256_${ARCH}.a"
+TEST_DIR="${RESULTS_DIR}/throughput_test_${ARCH}"
+
+# Bytes hashed per timed batch, and the slowdown in cycles/byte (percent,
+# sizes >= 4 KiB) that counts as a regression
+BATCH_BYTES="${THROUGHPUT_BATCH_BYTES:-16777216}"
+TOLERANCE="${THROUGHPUT_TOLERANCE:-10}"
+
+mkdir -p "${RESULTS_DIR}"
+: > "${LOG_FILE}"
+
+echo "🏎️  NanoSHA3-256 Throughput Benchmark"
+echo "===================================="
+
+# Benchmark program
+create_throughput_c() {
+    local test_file=$1
+
+    cat > "${test_file}" << 'EOF'
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "nano_sha3_256.h"
+
+// 0 B to 16 MB, both sides of the 136-byte rate and each power of four
+static const size_t SIZES[] = {
+    0, 1, 16, 64, 135, 136, 256, 1024, 4096, 16384, 65536,
+    262144, 1048576, 4194304, 16777216
+};
+#define SIZE_COUNT (sizeof(SIZES) / sizeof(SIZES[0]))
+#define MAX_SIZE 16777216
+
+// Streaming feeds the same message in chunks of this many bytes
+#define CHUNK 4096
+
+// Timed batches per point, the fastest one is reported
+#define BATCHES 5
+
+#if !defined(__x86_64__)
+#error "throughput_bench.c reads the TSC and is x86_64 only"
+#endif
+
+static inline uint64_t read_counter(void) {
+    uint32_t lo, hi;
+    // lfence keeps earlier work from drifting past the read
+    __asm__ volatile("lfence\n\trdtsc" : "=a"(lo), "=d"(hi) :: "memory");
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static uint64_t clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void hash_streaming(uint8_t *out, const uint8_t *msg, size_t len) {
+    nano_sha3_256_ctx ctx;
+    nano_sha3_256_init(&ctx);
+    for (size_t off = 0; off < len; off += CHUNK) {
+        nano_sha3_256_update(&ctx, msg + off, len - off < CHUNK ? len - off : CHUNK);
+    }
+    nano_sha3_256_final(&ctx, out);
+}
+
+int main(int argc, char **argv) {
+    size_t batch_bytes = argc > 1 ? strtoul(argv[1], NULL, 10) : 16777216;
+    uint8_t *msg = malloc(MAX_SIZE);
+    uint8_t digest[32], check[32];
+    if (!msg) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < MAX_SIZE; i++) {
+        msg[i] = (uint8_t)(i * 167 + (i >> 11));
+    }
+
+    // Both APIs must agree before anything is timed
+    for (size_t s = 0; s < SIZE_COUNT; s++) {
+        nano_sha3_256(digest, msg, SIZES[s]);
+        hash_streaming(check, msg, SIZES[s]);
+        if (memcmp(digest, check, 32) != 0) {
+            fprintf(stderr, "FAIL: streaming differs from one-shot at %zu bytes\n", SIZES[s]);
+            return 1;
+        }
+    }
+
+    uint64_t total_ticks = 0, total_ns = 0;
+    printf("api,bytes,iterations,cycles_per_call,cycles_per_byte,mb_per_sec,counter\n");
+    for (int api = 0; api < 2; api++) {
+        for (size_t s = 0; s < SIZE_COUNT; s++) {
+            size_t len = SIZES[s];
+            size_t iterations = len ? batch_bytes / len : 100000;
+            if (iterations < 1) {
+                iterations = 1;
+            }
+            if (iterations > 100000) {
+                iterations = 100000;
+            }
+
+            double best_ticks = 0, best_ns = 0;
+            for (int b = 0; b < BATCHES; b++) {
+                uint64_t ns0 = clock_ns();
+                uint64_t t0 = read_counter();
+                for (size_t i = 0; i < iterations; i++) {
+                    if (api == 0) {
+                        nano_sha3_256(digest, msg, len);
+                    } else {
+                        hash_streaming(digest, msg, len);
+                    }
+                }
+                uint64_t t1 = read_counter();
+                uint64_t ns1 = clock_ns();
+                total_ticks += t1 - t0;
+                total_ns += ns1 - ns0;
+                if (b == 0 || (double)(t1 - t0) < best_ticks) {
+                    best_ticks = (double)(t1 - t0);
+                    best_ns = (double)(ns1 - ns0);
+                }
+            }
+
+            double per_call = best_ticks / iterations;
+            printf("%s,%zu,%zu,%.1f,", api == 0 ? "one-shot" : "streaming", len, iterations, per_call);
+            if (len) {
+                printf("%.2f,%.2f,", per_call / len, (double)len * iterations / (best_ns * 1e-9) / 1e6);
+            } else {
+                printf("n/a,n/a,");
+            }
+            printf("rdtsc\n");
+        }
+    }
+
+    // Counter rate over the whole run, to turn counter ticks into time
+    fprintf(stderr, "counter_hz=%.0f\n", total_ns ? total_ticks / (total_ns * 1e-9) : 0.0);
+    free(msg);
+    return 0;
+}
+EOF
+}
+
+if [ ! -f "${STATICLIBS_DIR}/${STATIC_LIB}" ]; then
+    echo "❌ Static library not found: ${STATIC_LIB}. Run verify-build-staticlibs.sh first."
+    exit 1
+fi
+
+# Keep the last drop's numbers for the regression check
+if [ -f "${CSV_FILE}" ]; then
+    cp "${CSV_FILE}" "${PREVIOUS_CSV}"
+fi
+
+echo "arch,api,bytes,iterations,cycles_per_call,cycles_per_byte,mb_per_sec,counter,counter_hz" > "${CSV_FILE}"
+STATUS="MEASURED"
+COUNTER_HZ=""
+
+echo ""
+echo "🎯 ${ARCH} (${STATIC_LIB})"
+mkdir -p "${TEST_DIR}"
+cp "${HEADER_FILE}" "${TEST_DIR}/"
+create_throughput_c "${TEST_DIR}/throughput_bench.c"
+
+echo "   🔨 Compiling with gcc..."
+if ! gcc -O2 -Wall -Wextra -std=c99 -o "${TEST_DIR}/throughput_bench" \
+    "${TEST_DIR}/throughput_bench.c" "${STATICLIBS_DIR}/${STATIC_LIB}" 2>>"${LOG_FILE}"; then
+    echo "   ❌ Compilation failed (see ${LOG_FILE})"
+    STATUS="BUILD_FAILED"
+fi
+
+if [ "${STATUS}" = "MEASURED" ]; then
+    echo "   🏃 Running ($(( BATCH_BYTES / 1024 )) KiB per batch)..."
+    if "${TEST_DIR}/throughput_bench" "${BATCH_BYTES}" \
+        > "${TEST_DIR}/results.csv" 2> "${TEST_DIR}/stderr.log"; then
+        COUNTER_HZ=$(sed -n 's/^counter_hz=//p' "${TEST_DIR}/stderr.log")
+        tail -n +2 "${TEST_DIR}/results.csv" | sed "s/^/${ARCH},/; s/\$/,${COUNTER_HZ}/" >> "${CSV_FILE}"
+        grep ",16777216," "${TEST_DIR}/results.csv" | while IFS=',' read -r api bytes it cpc cpb mbps counter; do
+            echo "   ${api}: ${cpb} ${counter} ticks/byte, ${mbps} MB/s at 16 MB"
+        done || true
+    else
+        echo "   ❌ Benchmark failed: $(tail -1 "${TEST_DIR}/stderr.log")"
+        cat "${TEST_DIR}/stderr.log" >> "${LOG_FILE}"
+        STATUS="FAILED"
+    fi
+fi
+
+cat "${CSV_FILE}" >> "${LOG_FILE}"
+
+# Regression check against the previous run (sizes >= 4 KiB, cycles/byte)
+REGRESSIONS=()
+if [ -f "${PREVIOUS_CSV}" ]; then
+    while IFS= read -r line; do
+        REGRESSIONS+=("${line}")
+    done < <(awk -F',' -v tol="${TOLERANCE}" '
+        NR == FNR { if (FNR > 1) prev[$1 "," $2 "," $3] = $6; next }
+        FNR > 1 && $3 >= 4096 && ($1 "," $2 "," $3) in prev && prev[$1 "," $2 "," $3] > 0 {
+            change = 100 * ($6 / prev[$1 "," $2 "," $3] - 1)
+            if (change > tol) printf "%s %s %s B: %.2f -> %.2f cycles/byte (+%.1f%%)\n", $1, $2, $3, prev[$1 "," $2 "," $3], $6, change
+        }' "${PREVIOUS_CSV}" "${CSV_FILE}")
+fi
+
+if [ "${STATUS}" != "MEASURED" ]; then
+    FINAL_STATUS="FAILED"
+elif [ ${#REGRESSIONS[@]} -gt 0 ]; then
+    FINAL_STATUS="REGRESSION"
+else
+    FINAL_STATUS="ACHIEVED"
+fi
+echo "${FINAL_STATUS}" > "${RESULTS_DIR}/throughput-status.txt"
+
+CPU_MODEL=$(grep -m1 "model name" /proc/cpuinfo 2>/dev/null | cut -d: -f2 | sed 's/^ //' || echo "unknown")
+
+# Generate evidence
+cat > "${EVIDENCE_FILE}" << EOF
+# Throughput Evidence
+
+## Validation Method
+- **APIs**: \`nano_sha3_256()\` one-shot vs \`nano_sha3_256_init/update/final\` in 4 KiB chunks (digests compared before timing)
+- **Sizes**: 0 B to 16 MB (0, 1, 16, 64, 135, 136, 256 B, 1/4/16/64/256 KiB, 1/4/16 MiB)
+- **Scope**: x86_64 only (\`${STATIC_LIB}\`, native); the ARM Linux / AArch64 libraries only run under QEMU user-mode here and Cortex-M needs a bare-metal harness
+- **Counter**: \`rdtsc\` behind \`lfence\` (TSC reference cycles)
+- **Batches**: ${BATCH_BYTES} bytes per batch; fastest of 5 batches reported
+- **Regression check**: cycles/byte at ≥ 4 KiB against the previous run (\`throughput-previous.csv\`), > ${TOLERANCE}% slower is flagged
+- **Host CPU**: ${CPU_MODEL}
+- **Timestamp**: $(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+## Libraries
+| Library | Status | Counter rate (Hz) |
+|---------|--------|-------------------|
+EOF
+
+echo "| ${ARCH} | ${STATUS} | ${COUNTER_HZ:-n/a} |" >> "${EVIDENCE_FILE}"
+
+cat >> "${EVIDENCE_FILE}" << EOF
+
+## Results
+
+| Library | API | Bytes | Cycles/call | Cycles/byte | MB/s |
+|---------|-----|-------|-------------|-------------|------|
+EOF
+
+tail -n +2 "${CSV_FILE}" | while IFS=',' read -r arch api bytes it cpc cpb mbps counter hz; do
+    echo "| ${arch} | ${api} | ${bytes} | ${cpc} | ${cpb} | ${mbps} |" >> "${EVIDENCE_FILE}"
+done
+
+cat >> "${EVIDENCE_FILE}" << EOF
+
+## Regressions
+EOF
+if [ ! -f "${PREVIOUS_CSV}" ]; then
+    echo "- No previous run, this one is the baseline" >> "${EVIDENCE_FILE}"
+elif [ ${#REGRESSIONS[@]} -eq 0 ]; then
+    echo "- None above ${TOLERANCE}% against \`throughput-previous.csv\`" >> "${EVIDENCE_FILE}"
+else
+    for line in "${REGRESSIONS[@]}"; do
+        echo "- ${line}" >> "${EVIDENCE_FILE}"
+    done
+fi
+
+cat >> "${EVIDENCE_FILE}" << EOF
+
+## Notes
+- TSC ticks run at a fixed rate, so cycles/byte is stable across
+  frequency scaling but is not core clock cycles.
+- Cortex-M cycles/byte per variant is in build-results.csv
+  (verify-build-staticlibs.sh), not here.
+EOF
+
+# Generate badge
+BEST_MBPS=$(awk -F',' '$1 == "intel_x64" && $2 == "one-shot" && $3 == 16777216 { print $7 }' "${CSV_FILE}")
+if [ "${FINAL_STATUS}" = "ACHIEVED" ]; then
+    BADGE_COLOR="4c1"  # Green
+    BADGE_TEXT="${BEST_MBPS:-Measured}${BEST_MBPS:+ MB/s}"
+elif [ "${FINAL_STATUS}" = "REGRESSION" ]; then
+    BADGE_COLOR="fe7d37"  # Orange
+    BADGE_TEXT="Regression"
+else
+    BADGE_COLOR="e74c3c"  # Red
+    BADGE_TEXT="Failed"
+fi
+
+cat > "${RESULTS_DIR}/throughput-badge.svg" << EOF
+<svg xmlns="http://www.w3.org/2000/svg" width="160" height="20">
+  <rect width="160" height="20" fill="#555"/>
+  <rect x="75" width="85" height="20" fill="#${BADGE_COLOR}"/>
+  <text x="5" y="14" fill="#fff" font-family="Arial" font-size="11">Throughput</text>
+  <text x="80" y="14" fill="#fff" font-family="Arial" font-size="11">${BADGE_TEXT}</text>
+</svg>
+EOF
+
+echo ""
+echo "📊 Throughput Benchmark: ${FINAL_STATUS}"
+for line in "${REGRESSIONS[@]+"${REGRESSIONS[@]}"}"; do
+    echo "  ⚠ ${line}"
+done
+echo "📋 Evidence generated:"
+echo "  - Results: ${CSV_FILE}"
+echo "  - Evidence: ${EVIDENCE_FILE}"
+echo "  - Badge: ${RESULTS_DIR}/throughput-badge.svg"
+echo "  - Status: ${RESULTS_DIR}/throughput-status.txt"
+echo "  - Log: ${LOG_FILE}"
+
+[ "${FINAL_STATUS}" != "FAILED" ]
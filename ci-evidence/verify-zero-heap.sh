@@ -43,7 +43,7 @@ GLOBAL_ALLOCATOR=$(nm "${STATIC_LIB_PATH}" 2>/dev/null | grep -E "__rg_alloc|__r
 
 # Check source code for allocation patterns
 echo "📋 Checking source code for allocation patterns..."
-ALLOCATION_PATTERNS=$(grep -r "alloc\|vec\|box\|string" src/ --include="*.rs" | grep -v "//" | grep -v "alloc::" | grep -v "black_box" | grep -v "stream_file.rs" | head -10 || echo "")
+ALLOCATION_PATTERNS=$(grep -r "alloc\|vec\|box\|string" src/ ci-evidence/ffi/ --include="*.rs" | grep -v "//" | grep -v "alloc::" | grep -v "black_box" | grep -v "stream_file.rs" | head -10 || echo "")
 
 # Analyze the library interface
 echo "🔬 Analyzing public API for allocation safety..."
@@ -102,6 +102,7 @@ cat >> "${EVIDENCE_FILE}" << EOF
 - **Constructor**: NanoSha3_256::new() - stack allocation only
 - **Update Method**: .update() - processes data in-place
 - **Finalization**: .finalize() - returns fixed-size array
+- **C Streaming API**: nano_sha3_256_ctx - fixed-size, caller-allocated storage
 - **Return Types**: Fixed-size arrays, no dynamic allocation
 - **Error Handling**: No heap-based error types
 
@@ -0,0 +1,223 @@
+// nano_sha3_256_inline.h - header-only SHA3-256, bit-identical to the static libraries
+// Single file, static inline, C99 and C++. Everything is visible to the
+// compiler, so constant-length calls (32-byte digests, 64-byte Merkle
+// nodes) fold into straight-line code and need no LTO across the Rust FFI.
+// Same guarantees as the library: no heap, no data-dependent branches or
+// table lookups, contexts wiped on final. Can be used next to
+// nano_sha3_256.h; every name carries an _inline suffix.
+
+#ifndef NANO_SHA3_256_INLINE_H
+#define NANO_SHA3_256_INLINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef NANO_SHA3_256_INLINE
+#define NANO_SHA3_256_INLINE static inline
+#endif
+
+// SHA3-256 rate in bytes (1088 bits) and in 64-bit lanes
+#define NANO_SHA3_256_INLINE_RATE 136
+#define NANO_SHA3_256_INLINE_RATE_WORDS 17
+
+// Streaming context: the Keccak state plus the byte offset into the rate.
+// Input is XORed straight into the state, there is no block buffer.
+typedef struct {
+    uint64_t state[25];
+    size_t pos;
+} nano_sha3_256_inline_ctx;
+
+NANO_SHA3_256_INLINE uint64_t nano_sha3_256_inline_rol(uint64_t x, unsigned n) {
+    return (x << n) | (x >> ((64 - n) & 63));
+}
+
+// Little-endian loads and stores byte by byte (folded to one access on LE targets)
+NANO_SHA3_256_INLINE uint64_t nano_sha3_256_inline_load64(const uint8_t *p) {
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+NANO_SHA3_256_INLINE void nano_sha3_256_inline_store64(uint8_t *p, uint64_t x) {
+    for (unsigned i = 0; i < 8; i++) {
+        p[i] = (uint8_t)(x >> (8 * i));
+    }
+}
+
+// Keccak-f[1600], 24 rounds on 25 lanes (index x + 5y, as in FIPS 202)
+// The round is written out over locals so the state stays in registers
+// and every rotation amount is a constant.
+NANO_SHA3_256_INLINE void nano_sha3_256_inline_permute(uint64_t a[25]) {
+    static const uint64_t rc[24] = {
+        0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+        0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+        0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+        0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+        0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+        0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+    };
+    uint64_t a00 = a[0], a01 = a[1], a02 = a[2], a03 = a[3], a04 = a[4],
+             a05 = a[5], a06 = a[6], a07 = a[7], a08 = a[8], a09 = a[9],
+             a10 = a[10], a11 = a[11], a12 = a[12], a13 = a[13], a14 = a[14],
+             a15 = a[15], a16 = a[16], a17 = a[17], a18 = a[18], a19 = a[19],
+             a20 = a[20], a21 = a[21], a22 = a[22], a23 = a[23], a24 = a[24];
+    uint64_t b00, b01, b02, b03, b04, b05, b06, b07, b08, b09, b10, b11, b12;
+    uint64_t b13, b14, b15, b16, b17, b18, b19, b20, b21, b22, b23, b24;
+    uint64_t c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+
+    for (unsigned round = 0; round < 24; round++) {
+        // theta
+        c0 = a00 ^ a05 ^ a10 ^ a15 ^ a20;
+        c1 = a01 ^ a06 ^ a11 ^ a16 ^ a21;
+        c2 = a02 ^ a07 ^ a12 ^ a17 ^ a22;
+        c3 = a03 ^ a08 ^ a13 ^ a18 ^ a23;
+        c4 = a04 ^ a09 ^ a14 ^ a19 ^ a24;
+        d0 = c4 ^ nano_sha3_256_inline_rol(c1, 1);
+        d1 = c0 ^ nano_sha3_256_inline_rol(c2, 1);
+        d2 = c1 ^ nano_sha3_256_inline_rol(c3, 1);
+        d3 = c2 ^ nano_sha3_256_inline_rol(c4, 1);
+        d4 = c3 ^ nano_sha3_256_inline_rol(c0, 1);
+
+        // rho and pi: lane (x, y) moves to (y, 2x + 3y)
+        b00 = a00 ^ d0;
+        b01 = nano_sha3_256_inline_rol(a06 ^ d1, 44);
+        b02 = nano_sha3_256_inline_rol(a12 ^ d2, 43);
+        b03 = nano_sha3_256_inline_rol(a18 ^ d3, 21);
+        b04 = nano_sha3_256_inline_rol(a24 ^ d4, 14);
+        b05 = nano_sha3_256_inline_rol(a03 ^ d3, 28);
+        b06 = nano_sha3_256_inline_rol(a09 ^ d4, 20);
+        b07 = nano_sha3_256_inline_rol(a10 ^ d0, 3);
+        b08 = nano_sha3_256_inline_rol(a16 ^ d1, 45);
+        b09 = nano_sha3_256_inline_rol(a22 ^ d2, 61);
+        b10 = nano_sha3_256_inline_rol(a01 ^ d1, 1);
+        b11 = nano_sha3_256_inline_rol(a07 ^ d2, 6);
+        b12 = nano_sha3_256_inline_rol(a13 ^ d3, 25);
+        b13 = nano_sha3_256_inline_rol(a19 ^ d4, 8);
+        b14 = nano_sha3_256_inline_rol(a20 ^ d0, 18);
+        b15 = nano_sha3_256_inline_rol(a04 ^ d4, 27);
+        b16 = nano_sha3_256_inline_rol(a05 ^ d0, 36);
+        b17 = nano_sha3_256_inline_rol(a11 ^ d1, 10);
+        b18 = nano_sha3_256_inline_rol(a17 ^ d2, 15);
+        b19 = nano_sha3_256_inline_rol(a23 ^ d3, 56);
+        b20 = nano_sha3_256_inline_rol(a02 ^ d2, 62);
+        b21 = nano_sha3_256_inline_rol(a08 ^ d3, 55);
+        b22 = nano_sha3_256_inline_rol(a14 ^ d4, 39);
+        b23 = nano_sha3_256_inline_rol(a15 ^ d0, 41);
+        b24 = nano_sha3_256_inline_rol(a21 ^ d1, 2);
+
+        // chi, then iota
+        a00 = b00 ^ (~b01 & b02);
+        a01 = b01 ^ (~b02 & b03);
+        a02 = b02 ^ (~b03 & b04);
+        a03 = b03 ^ (~b04 & b00);
+        a04 = b04 ^ (~b00 & b01);
+        a05 = b05 ^ (~b06 & b07);
+        a06 = b06 ^ (~b07 & b08);
+        a07 = b07 ^ (~b08 & b09);
+        a08 = b08 ^ (~b09 & b05);
+        a09 = b09 ^ (~b05 & b06);
+        a10 = b10 ^ (~b11 & b12);
+        a11 = b11 ^ (~b12 & b13);
+        a12 = b12 ^ (~b13 & b14);
+        a13 = b13 ^ (~b14 & b10);
+        a14 = b14 ^ (~b10 & b11);
+        a15 = b15 ^ (~b16 & b17);
+        a16 = b16 ^ (~b17 & b18);
+        a17 = b17 ^ (~b18 & b19);
+        a18 = b18 ^ (~b19 & b15);
+        a19 = b19 ^ (~b15 & b16);
+        a20 = b20 ^ (~b21 & b22);
+        a21 = b21 ^ (~b22 & b23);
+        a22 = b22 ^ (~b23 & b24);
+        a23 = b23 ^ (~b24 & b20);
+        a24 = b24 ^ (~b20 & b21);
+        a00 ^= rc[round];
+    }
+
+    a[0] = a00; a[1] = a01; a[2] = a02; a[3] = a03; a[4] = a04;
+    a[5] = a05; a[6] = a06; a[7] = a07; a[8] = a08; a[9] = a09;
+    a[10] = a10; a[11] = a11; a[12] = a12; a[13] = a13; a[14] = a14;
+    a[15] = a15; a[16] = a16; a[17] = a17; a[18] = a18; a[19] = a19;
+    a[20] = a20; a[21] = a21; a[22] = a22; a[23] = a23; a[24] = a24;
+}
+
+// Initialize a streaming context
+// @param ctx: caller-allocated context (overwritten)
+NANO_SHA3_256_INLINE void nano_sha3_256_inline_init(nano_sha3_256_inline_ctx *ctx) {
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+// Absorb the next chunk of input
+// @param ctx: context initialized with nano_sha3_256_inline_init
+// @param input: input data chunk (may be NULL when len is 0)
+// @param len: length of chunk in bytes
+NANO_SHA3_256_INLINE void nano_sha3_256_inline_update(nano_sha3_256_inline_ctx *ctx, const uint8_t *input, size_t len) {
+    size_t pos = ctx->pos;
+
+    // Top up a partial block byte by byte
+    while (len > 0 && pos != 0) {
+        ctx->state[pos / 8] ^= (uint64_t)*input++ << (8 * (pos % 8));
+        len--;
+        if (++pos == NANO_SHA3_256_INLINE_RATE) {
+            nano_sha3_256_inline_permute(ctx->state);
+            pos = 0;
+        }
+    }
+
+    // Whole blocks as 17 little-endian words each
+    while (len >= NANO_SHA3_256_INLINE_RATE) {
+        for (unsigned i = 0; i < NANO_SHA3_256_INLINE_RATE_WORDS; i++) {
+            ctx->state[i] ^= nano_sha3_256_inline_load64(input + 8 * i);
+        }
+        nano_sha3_256_inline_permute(ctx->state);
+        input += NANO_SHA3_256_INLINE_RATE;
+        len -= NANO_SHA3_256_INLINE_RATE;
+    }
+
+    // Tail of the last block
+    for (; len > 0; len--, pos++) {
+        ctx->state[pos / 8] ^= (uint64_t)*input++ << (8 * (pos % 8));
+    }
+    ctx->pos = pos;
+}
+
+// Finish the hash and write the digest
+// @param ctx: context to finalize (wiped; call init again before reuse)
+// @param out: output buffer (must be 32 bytes)
+NANO_SHA3_256_INLINE void nano_sha3_256_inline_final(nano_sha3_256_inline_ctx *ctx, uint8_t *out) {
+    // SHA-3 domain bits 01, then pad10*1
+    ctx->state[ctx->pos / 8] ^= (uint64_t)0x06 << (8 * (ctx->pos % 8));
+    ctx->state[NANO_SHA3_256_INLINE_RATE_WORDS - 1] ^= 0x8000000000000000ULL;
+    nano_sha3_256_inline_permute(ctx->state);
+    for (unsigned i = 0; i < 4; i++) {
+        nano_sha3_256_inline_store64(out + 8 * i, ctx->state[i]);
+    }
+
+    // Volatile stores so the wipe survives dead-store elimination
+    volatile uint64_t *wipe = ctx->state;
+    for (unsigned i = 0; i < 25; i++) {
+        wipe[i] = 0;
+    }
+    *(volatile size_t *)&ctx->pos = 0;
+}
+
+// Single-call SHA3-256 hash function
+// @param out: output buffer (must be 32 bytes)
+// @param input: input data to hash (may be NULL when len is 0)
+// @param len: length of input data in bytes
+NANO_SHA3_256_INLINE void nano_sha3_256_inline(uint8_t *out, const uint8_t *input, size_t len) {
+    nano_sha3_256_inline_ctx ctx;
+    nano_sha3_256_inline_init(&ctx);
+    nano_sha3_256_inline_update(&ctx, input, len);
+    nano_sha3_256_inline_final(&ctx, out);
+}
+
+// SHA3-256 of one 64-byte Merkle node (two child digests), same result as
+// nano_sha3_256_node64; one block, one permutation
+// @param out: output buffer (32 bytes, may alias the first half of node)
+// @param node: 64 input bytes
+NANO_SHA3_256_INLINE void nano_sha3_256_inline_node64(uint8_t *out, const uint8_t *node) {
+    nano_sha3_256_inline(out, node, 64);
+}
+
+#endif // NANO_SHA3_256_INLINE_H
@@ -0,0 +1,1369 @@
+/*
+ * NIST SHA3-256 Validation using Static Library
+ * Tests 237 critical NIST CAVS test vectors against the actual static library
+ * that customers receive, ensuring complete validation consistency.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "nano_sha3_256.h"
+#include "nano_sha3_256_inline.h"
+
+typedef struct {
+    size_t len;
+    uint8_t *msg;
+    uint8_t md[32];
+} TestVector;
+
+// A .rsp file mapped read-only, plus the one arena every decoded field and
+// scratch output of that file is carved from. Hex text decodes to half its
+// size and no record needs more scratch than its own hex, so the file size
+// bounds the arena; nothing is allocated per message.
+typedef struct {
+    const char *text;
+    size_t size;
+    size_t pos;
+    uint8_t *arena;
+    size_t arena_size;
+    size_t arena_used;
+} RspFile;
+
+// Hex digit value plus one, 0 for every byte that is not a hex digit
+static const uint8_t HEX_VALUE[256] = {
+    ['0'] = 1,  ['1'] = 2,  ['2'] = 3,  ['3'] = 4,  ['4'] = 5,
+    ['5'] = 6,  ['6'] = 7,  ['7'] = 8,  ['8'] = 9,  ['9'] = 10,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
+
+int rsp_open(RspFile *f, const char *filename) {
+    memset(f, 0, sizeof(*f));
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0) {
+        printf("ERROR: Cannot open test vector file: %s\n", filename);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return -1;
+    }
+    
+    f->size = (size_t)st.st_size;
+    void *text = mmap(NULL, f->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (text == MAP_FAILED) {
+        printf("ERROR: Cannot map test vector file: %s\n", filename);
+        return -1;
+    }
+    posix_madvise(text, f->size, POSIX_MADV_SEQUENTIAL);
+    f->text = text;
+    
+    // Slack for the 8-byte alignment of each allocation
+    f->arena_size = f->size + 1024;
+    f->arena = malloc(f->arena_size);
+    if (!f->arena) {
+        printf("ERROR: Memory allocation failed for %zu bytes\n", f->arena_size);
+        munmap(text, f->size);
+        return -1;
+    }
+    return 0;
+}
+
+void rsp_close(RspFile *f) {
+    munmap((void *)f->text, f->size);
+    free(f->arena);
+}
+
+// n bytes from the arena (8-byte aligned), NULL once it is exhausted
+uint8_t *rsp_alloc(RspFile *f, size_t n) {
+    size_t at = (f->arena_used + 7) & ~(size_t)7;
+    if (at > f->arena_size || n > f->arena_size - at) {
+        printf("ERROR: Arena exhausted (%zu of %zu bytes)\n", at, f->arena_size);
+        return NULL;
+    }
+    f->arena_used = at + n;
+    return f->arena + at;
+}
+
+// Next line without its line ending; returns 0 at the end of the file
+int rsp_line(RspFile *f, const char **line, size_t *len) {
+    if (f->pos >= f->size) {
+        return 0;
+    }
+    const char *start = f->text + f->pos;
+    const char *newline = memchr(start, '\n', f->size - f->pos);
+    size_t n = newline ? (size_t)(newline - start) : f->size - f->pos;
+    f->pos += n + (newline != NULL);
+    if (n > 0 && start[n - 1] == '\r') {
+        n--;
+    }
+    *line = start;
+    *len = n;
+    return 1;
+}
+
+// Value of "key" at the start of the line (n set to its length), else NULL
+const char *rsp_field(const char *line, size_t len, const char *key, size_t *n) {
+    size_t key_len = strlen(key);
+    if (len < key_len || memcmp(line, key, key_len) != 0) {
+        return NULL;
+    }
+    *n = len - key_len;
+    return line + key_len;
+}
+
+// Decimal value of the leading digits (mapped lines are not NUL-terminated)
+size_t rsp_number(const char *value, size_t n) {
+    size_t v = 0;
+    for (size_t i = 0; i < n && value[i] >= '0' && value[i] <= '9'; i++) {
+        v = v * 10 + (size_t)(value[i] - '0');
+    }
+    return v;
+}
+
+// Decode n hex digits into the arena; NULL on odd length or a non-hex digit.
+// Invalid digits are collected with one OR per byte and checked once.
+uint8_t *rsp_hex(RspFile *f, const char *hex, size_t n, size_t *len) {
+    if (n % 2 != 0) {
+        printf("ERROR: Invalid hex string length: %zu\n", n);
+        return NULL;
+    }
+    uint8_t *bytes = rsp_alloc(f, n / 2);
+    if (!bytes) {
+        return NULL;
+    }
+    
+    const uint8_t *in = (const uint8_t *)hex;
+    unsigned bad = 0;
+    for (size_t i = 0; i < n / 2; i++) {
+        unsigned hi = HEX_VALUE[in[2 * i]] - 1u;
+        unsigned lo = HEX_VALUE[in[2 * i + 1]] - 1u;
+        bad |= hi | lo;
+        bytes[i] = (uint8_t)((hi << 4) | (lo & 0x0f));
+    }
+    if (bad > 0x0f) {
+        printf("ERROR: Invalid hex digit in '%.16s...'\n", hex);
+        return NULL;
+    }
+    *len = n / 2;
+    return bytes;
+}
+
+// Customization string of an S = "..." line, truncated to fit custom
+void rsp_string(const char *value, size_t n, char *custom, size_t size) {
+    if (n > 0 && value[n - 1] == '"') {
+        n--;
+    }
+    if (n >= size) {
+        n = size - 1;
+    }
+    memcpy(custom, value, n);
+    custom[n] = '\0';
+}
+
+// Convert bytes to hex string
+void bytes_to_hex(const uint8_t *bytes, size_t len, char *hex_str) {
+    const char hex_chars[] = "0123456789abcdef";
+    for (size_t i = 0; i < len; i++) {
+        hex_str[i*2] = hex_chars[bytes[i] >> 4];
+        hex_str[i*2+1] = hex_chars[bytes[i] & 0x0f];
+    }
+    hex_str[len*2] = '\0';
+}
+
+// Chunk sizes used to split each message for the streaming API
+// (single bytes, odd sizes, exactly one rate block, and straddling blocks)
+static const size_t STREAM_CHUNKS[] = {1, 7, 136, 137};
+#define STREAM_CHUNK_COUNT (sizeof(STREAM_CHUNKS) / sizeof(STREAM_CHUNKS[0]))
+
+// Hash a message through nano_sha3_256_init/update/final in fixed-size chunks
+void hash_streaming(uint8_t *out, const uint8_t *msg, size_t len, size_t chunk) {
+    nano_sha3_256_ctx ctx;
+    nano_sha3_256_init(&ctx);
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = (len - off < chunk) ? len - off : chunk;
+        nano_sha3_256_update(&ctx, msg + off, n);
+    }
+    nano_sha3_256_final(&ctx, out);
+}
+
+// Hash a message with the header-only implementation, one-shot and then in
+// fixed-size chunks; returns 0 if the two disagree
+int hash_inline(uint8_t *out, const uint8_t *msg, size_t len, size_t chunk) {
+    nano_sha3_256_inline_ctx ctx;
+    uint8_t streamed[32];
+    
+    nano_sha3_256_inline(out, msg, len);
+    nano_sha3_256_inline_init(&ctx);
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = (len - off < chunk) ? len - off : chunk;
+        nano_sha3_256_inline_update(&ctx, msg + off, n);
+    }
+    nano_sha3_256_inline_final(&ctx, streamed);
+    return memcmp(out, streamed, 32) == 0;
+}
+
+// Most fragments one scatter-gather message is split into
+#define IOV_MAX_FRAGMENTS 64
+
+// Hash a message through nano_sha3_256_v, split at pseudo-random points
+// (xorshift32 from seed): fragments of 1 to 299 bytes with about one in
+// sixteen empty, so rate blocks straddle fragments anywhere; the last
+// fragment takes the rest
+void hash_iov(uint8_t *out, const uint8_t *msg, size_t len, uint32_t seed) {
+    struct nano_sha3_iov iov[IOV_MAX_FRAGMENTS];
+    uint32_t x = seed * 2654435761u + 1;
+    size_t n = 0, off = 0;
+    
+    while (off < len && n < IOV_MAX_FRAGMENTS - 1) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        size_t take = (x >> 28) == 0 ? 0 : 1 + x % 299;
+        if (take > len - off) {
+            take = len - off;
+        }
+        iov[n].base = msg + off;
+        iov[n].len = take;
+        off += take;
+        n++;
+    }
+    iov[n].base = msg ? msg + off : NULL;
+    iov[n].len = len - off;
+    n++;
+    nano_sha3_256_v(out, iov, n);
+}
+
+// Hash a message through nano_sha3_256_update_step, one bounded step per call
+void hash_stepped(uint8_t *out, const uint8_t *msg, size_t len) {
+    nano_sha3_256_ctx ctx;
+    nano_sha3_256_init(&ctx);
+    size_t off = 0;
+    int status;
+    do {
+        size_t consumed = 0;
+        status = nano_sha3_256_update_step(&ctx, msg + off, len - off, &consumed);
+        off += consumed;
+    } while (status == NANO_SHA3_256_MORE);
+    nano_sha3_256_final(&ctx, out);
+}
+
+// Hash a message as a midstate over its first half plus the rest, then
+// again from a clone of the same midstate; returns 0 if the two disagree
+// (from_midstate must leave the midstate untouched)
+int hash_midstate(uint8_t *out, const uint8_t *msg, size_t len) {
+    nano_sha3_256_ctx midstate, fork;
+    size_t split = len / 2;
+    const uint8_t *rest = msg ? msg + split : NULL;
+    uint8_t again[32];
+    
+    nano_sha3_256_prefix(&midstate, msg, split);
+    nano_sha3_256_from_midstate(out, &midstate, rest, len - split);
+    nano_sha3_256_clone(&fork, &midstate);
+    nano_sha3_256_update(&fork, rest, len - split);
+    nano_sha3_256_final(&fork, again);
+    return memcmp(out, again, 32) == 0;
+}
+
+// DMA half-buffer sizes: one rate, unaligned, two rates (block-aligned hand-off)
+static const size_t DMA_HALVES[] = {136, 200, 272};
+
+// Feed msg through a simulated circular DMA in half_len chunks; the
+// peripheral side copies into the ping-pong buffer, the hash reads it there
+void hash_dma(uint8_t *out, const uint8_t *msg, size_t len, size_t half_len) {
+    static uint8_t dma_buf[2 * 272];
+    nano_sha3_256_dma dma;
+    size_t off = 0;
+    int half = 0;
+    
+    nano_sha3_256_dma_init(&dma, dma_buf, half_len);
+    while (len - off >= half_len) {
+        memcpy(dma_buf + half * half_len, msg + off, half_len);
+        nano_sha3_256_dma_absorb_half(&dma);
+        off += half_len;
+        half ^= 1;
+    }
+    if (len > off) {
+        memcpy(dma_buf + half * half_len, msg + off, len - off);
+    }
+    nano_sha3_256_dma_final(&dma, len - off, out);
+}
+
+// Merkle level of NODE_LEVEL nodes (odd, so every lane count leaves a tail)
+#define NODE_LEVEL 37
+
+// Check nano_sha3_256_node64_many against the one-shot on one level, into a
+// separate buffer and reduced in place
+int check_node64_level(void) {
+    static uint8_t level[NODE_LEVEL * 64];
+    static uint8_t in_place[NODE_LEVEL * 64];
+    uint8_t digests[NODE_LEVEL * 32];
+    
+    for (size_t i = 0; i < sizeof(level); i++) {
+        level[i] = (uint8_t)(i * 131 + (i >> 8));
+    }
+    memcpy(in_place, level, sizeof(level));
+    nano_sha3_256_node64_many(digests, level, NODE_LEVEL);
+    nano_sha3_256_node64_many(in_place, in_place, NODE_LEVEL);
+    
+    int ok = 1;
+    for (size_t n = 0; n < NODE_LEVEL; n++) {
+        uint8_t expected[32];
+        nano_sha3_256(expected, level + 64 * n, 64);
+        if (memcmp(digests + 32 * n, expected, 32) != 0 || memcmp(in_place + 32 * n, expected, 32) != 0) {
+            printf("FAIL: nano_sha3_256_node64_many node %zu of %d\n", n, NODE_LEVEL);
+            ok = 0;
+        }
+    }
+    return ok;
+}
+
+#ifdef NANO_SHA3_256_COUNTERS
+// Check the counters of a "counters" library against counts worked out by
+// hand: per-context over a split stream, clone and final, and the totals
+// over a one-shot plus a Merkle level
+int check_counters(void) {
+    static uint8_t msg[NODE_LEVEL * 64];
+    static const size_t chunks[] = {100, 100, 200, 7};
+    nano_sha3_256_ctx ctx, fork;
+    nano_sha3_256_counters c, g;
+    uint8_t out[32];
+    int ok = 1;
+    
+    nano_sha3_256_reset_counters();
+    nano_sha3_256_init(&ctx);
+    for (size_t i = 0, off = 0; i < sizeof(chunks) / sizeof(chunks[0]); off += chunks[i], i++) {
+        nano_sha3_256_update(&ctx, msg + off, chunks[i]);
+    }
+    nano_sha3_256_clone(&fork, &ctx);
+    nano_sha3_256_final(&ctx, out);
+    
+    // 407 bytes: two full blocks in update, the padded third in final
+    nano_sha3_256_get_counters(&ctx, &c);
+    if (c.permutations != 3 || c.full_blocks != 2 || c.partial_blocks != 1 || c.bytes != 407) {
+        printf("FAIL: context counters %llu/%llu/%llu/%llu, expected 3/2/1/407\n",
+               (unsigned long long)c.permutations, (unsigned long long)c.full_blocks,
+               (unsigned long long)c.partial_blocks, (unsigned long long)c.bytes);
+        ok = 0;
+    }
+    nano_sha3_256_get_counters(&fork, &c);
+    if (c.permutations != 2 || c.full_blocks != 2 || c.partial_blocks != 0 || c.bytes != 407) {
+        printf("FAIL: cloned context counters do not match the source\n");
+        ok = 0;
+    }
+    
+    // Plus a 300-byte one-shot (3 permutations) and NODE_LEVEL nodes
+    nano_sha3_256(out, msg, 300);
+    nano_sha3_256_node64_many(msg, msg, NODE_LEVEL);
+    nano_sha3_256_get_counters(NULL, &g);
+    if (g.permutations != 6 + NODE_LEVEL || g.full_blocks != 4 || g.partial_blocks != 2 + NODE_LEVEL ||
+        g.bytes != 707 + 64 * NODE_LEVEL) {
+        printf("FAIL: library-wide counters %llu/%llu/%llu/%llu\n",
+               (unsigned long long)g.permutations, (unsigned long long)g.full_blocks,
+               (unsigned long long)g.partial_blocks, (unsigned long long)g.bytes);
+        ok = 0;
+    }
+    nano_sha3_256_reset_counters();
+    return ok;
+}
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64) || (defined(__arm__) && defined(__linux__))
+#define HAVE_MULTIBUF_X2 1
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(HAVE_MULTIBUF_X2)
+#define HAVE_MULTIBUF 1
+#endif
+
+#ifdef HAVE_MULTIBUF
+// Check vectors 2, 4 or 8 at a time through the multi-buffer API
+// Lane j of batch b carries vector b + j (wrapping around), so every batch
+// mixes message lengths. Clears ok[i] for each vector that mismatches.
+void check_multibuf(const TestVector *vectors, size_t count, size_t lanes, const char *test_name, int *ok) {
+    for (size_t b = 0; b < count; b += lanes) {
+        uint8_t digests[8][32];
+        uint8_t *out[8] = {0};
+        const uint8_t *in[8] = {0};
+        size_t len[8] = {0};
+        size_t idx[8] = {0};
+        
+        for (size_t j = 0; j < lanes; j++) {
+            idx[j] = (b + j) % count;
+            out[j] = digests[j];
+            in[j] = vectors[idx[j]].msg;
+            len[j] = vectors[idx[j]].len / 8;
+        }
+        
+#ifdef HAVE_MULTIBUF_X2
+        nano_sha3_256_x2(out, in, len);
+#else
+        if (lanes == 4) {
+            nano_sha3_256_x4(out, in, len);
+        } else {
+            nano_sha3_256_x8(out, in, len);
+        }
+#endif
+        
+        for (size_t j = 0; j < lanes; j++) {
+            if (memcmp(digests[j], vectors[idx[j]].md, 32) != 0) {
+                char computed_hex[65];
+                bytes_to_hex(digests[j], 32, computed_hex);
+                printf("FAIL: %s Vector %zu (Len=%zu) x%zu lane %zu: %s\n",
+                       test_name, idx[j] + 1, vectors[idx[j]].len, lanes, j, computed_hex);
+                ok[idx[j]] = 0;
+            }
+        }
+    }
+}
+
+// Check all vectors as one nano_sha3_256_batch, on one worker and on four
+// (runs are stolen across workers); digest slots come from the file arena.
+// Clears ok[i] for each vector that mismatches.
+int check_batch(RspFile *f, const TestVector *vectors, size_t count, const char *test_name, int *ok) {
+    static const size_t threads[] = {1, 4};
+    nano_sha3_256_job *jobs = (nano_sha3_256_job *)rsp_alloc(f, count * sizeof(nano_sha3_256_job));
+    uint8_t *digests = rsp_alloc(f, count * 32);
+    if (!jobs || !digests) {
+        return -1;
+    }
+    
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        memset(digests, 0, count * 32);
+        for (size_t i = 0; i < count; i++) {
+            jobs[i].input = vectors[i].msg;
+            jobs[i].len = vectors[i].len / 8;
+            jobs[i].out = digests + 32 * i;
+        }
+        if (nano_sha3_256_batch(jobs, count, threads[t]) != 0) {
+            printf("FAIL: %s nano_sha3_256_batch rejected %zu jobs\n", test_name, count);
+            return -1;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (memcmp(digests + 32 * i, vectors[i].md, 32) != 0) {
+                printf("FAIL: %s Vector %zu (Len=%zu) via nano_sha3_256_batch, %zu threads\n",
+                       test_name, i + 1, vectors[i].len, threads[t]);
+                ok[i] = 0;
+            }
+        }
+    }
+    return 0;
+}
+#endif
+
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)) && \
+    !defined(NANO_SHA3_256_SINGLE_KERNEL)
+// Runtime-dispatched single-message permutation (intel_x64, aarch64); define
+// NANO_SHA3_256_SINGLE_KERNEL for a host build on one fixed kernel
+#define HAVE_KERNELS 1
+
+static const struct {
+    int id;
+    const char *name;
+} KERNELS[] = {
+#if defined(__x86_64__) || defined(_M_X64)
+    {NANO_SHA3_256_KERNEL_SCALAR, "scalar"},
+    {NANO_SHA3_256_KERNEL_BMI2, "bmi2"},
+    {NANO_SHA3_256_KERNEL_AVX512, "avx512"},
+#else
+    {NANO_SHA3_256_KERNEL_SCALAR, "scalar"},
+    {NANO_SHA3_256_KERNEL_SHA3, "sha3"},
+#endif
+};
+
+// Check every vector on each permutation kernel this CPU supports, not only
+// the one dispatch picks. Clears ok[i] for each vector that mismatches.
+void check_kernels(const TestVector *vectors, size_t count, const char *test_name, int *ok) {
+    for (size_t k = 0; k < sizeof(KERNELS) / sizeof(KERNELS[0]); k++) {
+        if (nano_sha3_256_set_kernel(KERNELS[k].id) != 0) {
+            printf("  %s kernel %s not supported by this CPU, skipped\n", test_name, KERNELS[k].name);
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint8_t digest[32];
+            nano_sha3_256(digest, vectors[i].msg, vectors[i].len / 8);
+            if (memcmp(digest, vectors[i].md, 32) != 0) {
+                printf("FAIL: %s Vector %zu (Len=%zu) on kernel %s\n",
+                       test_name, i + 1, vectors[i].len, KERNELS[k].name);
+                ok[i] = 0;
+            }
+        }
+        printf("  %s kernel %s checked\n", test_name, KERNELS[k].name);
+    }
+    nano_sha3_256_set_kernel(NANO_SHA3_256_KERNEL_AUTO);
+}
+
+// Checkpoints (intel_x64 and aarch64 have them; arm_linux, on the core
+// crate, does not):
+// export at block boundaries and mid-block, resume in a fresh context and
+// finish the message; a re-export must give the same image, and damaged
+// images must be rejected
+int check_checkpoint(void) {
+    static const size_t splits[] = {0, 1, 135, 136, 137, 500, 1000};
+    static uint8_t msg[1000];
+    uint8_t image[NANO_SHA3_256_EXPORT_SIZE], again[NANO_SHA3_256_EXPORT_SIZE];
+    uint8_t expected[32], digest[32];
+    nano_sha3_256_ctx ctx, resumed;
+    int ok = 1;
+    
+    for (size_t i = 0; i < sizeof(msg); i++) {
+        msg[i] = (uint8_t)(i * 167 + 13);
+    }
+    nano_sha3_256(expected, msg, sizeof(msg));
+    
+    for (size_t s = 0; s < sizeof(splits) / sizeof(splits[0]); s++) {
+        size_t at = splits[s];
+        nano_sha3_256_init(&ctx);
+        nano_sha3_256_update(&ctx, msg, at);
+        nano_sha3_256_export(&ctx, image);
+        
+        memset(&resumed, 0xA5, sizeof(resumed));
+        if (nano_sha3_256_import(&resumed, image) != 0) {
+            printf("FAIL: checkpoint at byte %zu rejected\n", at);
+            ok = 0;
+            continue;
+        }
+        nano_sha3_256_export(&resumed, again);
+        nano_sha3_256_update(&resumed, msg + at, sizeof(msg) - at);
+        nano_sha3_256_final(&resumed, digest);
+        if (memcmp(image, again, sizeof(image)) != 0 || memcmp(digest, expected, 32) != 0) {
+            printf("FAIL: hash resumed from byte %zu differs\n", at);
+            ok = 0;
+        }
+        if (image[6] != at % 136 || image[7] != 0 || memcmp(image, "NS3C\x01", 5) != 0) {
+            printf("FAIL: checkpoint header at byte %zu\n", at);
+            ok = 0;
+        }
+        
+        // A torn write anywhere, or another format version, must not import
+        for (size_t b = 0; b < sizeof(image); b += 23) {
+            image[b] ^= 0x10;
+            if (nano_sha3_256_import(&resumed, image) != -1) {
+                printf("FAIL: damaged checkpoint (byte %zu) accepted\n", b);
+                ok = 0;
+            }
+            image[b] ^= 0x10;
+        }
+        nano_sha3_256_final(&ctx, digest);
+    }
+    return ok;
+}
+#endif
+
+// Parse a NIST ShortMsg/LongMsg file into a table of vectors, table and
+// messages both in the file's arena (one pass to size the table, one to fill it)
+int parse_test_vectors(RspFile *f, TestVector **vectors, size_t *count) {
+    const char *line, *value;
+    size_t len, n, records = 0;
+    
+    while (rsp_line(f, &line, &len)) {
+        records += rsp_field(line, len, "Len = ", &n) != NULL;
+    }
+    f->pos = 0;
+    
+    TestVector *vec_array = (TestVector *)rsp_alloc(f, (records ? records : 1) * sizeof(TestVector));
+    if (!vec_array) {
+        return -1;
+    }
+    size_t vec_count = 0;
+    TestVector *current = NULL;
+    
+    while (rsp_line(f, &line, &len)) {
+        if ((value = rsp_field(line, len, "Len = ", &n)) != NULL) {
+            current = &vec_array[vec_count++];
+            current->len = rsp_number(value, n);
+            current->msg = NULL;
+            memset(current->md, 0, 32);
+            
+        } else if (current && (value = rsp_field(line, len, "Msg = ", &n)) != NULL) {
+            // Len = 0 still carries "Msg = 00"; the message stays NULL
+            if (current->len > 0) {
+                size_t msg_len = 0;
+                current->msg = rsp_hex(f, value, n, &msg_len);
+                if (!current->msg) {
+                    printf("ERROR: Failed to parse message hex for Len=%zu\n", current->len);
+                    return -1;
+                }
+                // Verify the parsed length matches expected bit length
+                if (msg_len * 8 != current->len) {
+                    printf("ERROR: Message length mismatch: expected %zu bits (%zu bytes), got %zu bytes\n",
+                           current->len, current->len / 8, msg_len);
+                    return -1;
+                }
+            }
+            
+        } else if (current && (value = rsp_field(line, len, "MD = ", &n)) != NULL) {
+            size_t md_len = 0;
+            size_t mark = f->arena_used;
+            uint8_t *md_bytes = rsp_hex(f, value, n, &md_len);
+            if (!md_bytes) {
+                printf("ERROR: Failed to parse MD hex\n");
+                return -1;
+            }
+            if (md_len != 32) {
+                printf("ERROR: Invalid MD length: expected 32, got %zu\n", md_len);
+                return -1;
+            }
+            memcpy(current->md, md_bytes, 32);
+            f->arena_used = mark;
+        }
+    }
+    
+    *vectors = vec_array;
+    *count = vec_count;
+    return 0;
+}
+
+// One SHAKE variant: one-shot and incremental entry points
+typedef struct {
+    const char *name;
+    void (*oneshot)(uint8_t *, size_t, const uint8_t *, size_t);
+    void (*init)(nano_shake_ctx *);
+    int (*absorb)(nano_shake_ctx *, const uint8_t *, size_t);
+    void (*squeeze)(nano_shake_ctx *, uint8_t *, size_t);
+} ShakeVariant;
+
+static const ShakeVariant SHAKE128 = {"SHAKE128", nano_shake128, nano_shake128_init,
+                                      nano_shake128_absorb, nano_shake128_squeeze};
+static const ShakeVariant SHAKE256 = {"SHAKE256", nano_shake256, nano_shake256_init,
+                                      nano_shake256_absorb, nano_shake256_squeeze};
+
+#ifdef HAVE_MULTIBUF
+// One rate of the 4-way SHAKE API
+typedef struct {
+    size_t rate;
+    void (*absorb)(nano_shake_x4_ctx *, const uint8_t *const[4], size_t);
+    void (*squeezeblocks)(nano_shake_x4_ctx *, uint8_t *const[4], size_t);
+} ShakeX4Variant;
+
+static const ShakeX4Variant SHAKE128_X4 = {NANO_SHAKE128_RATE, nano_shake128_x4_absorb,
+                                           nano_shake128_x4_squeezeblocks};
+static const ShakeX4Variant SHAKE256_X4 = {NANO_SHAKE256_RATE, nano_shake256_x4_absorb,
+                                           nano_shake256_x4_squeezeblocks};
+
+#define SHAKE_X4_MAX_MSG 8192
+#define SHAKE_X4_MAX_OUT (2048 + NANO_SHAKE128_RATE)
+
+// Check one SHAKE vector through the 4-way API: lane 0 carries the vector,
+// lanes 1-3 copies with one byte flipped (checked against the one-shot), so
+// a lane mix-up cannot pass. Squeezes one block, then all remaining ones.
+static int check_shake_x4(const ShakeVariant *v, const ShakeX4Variant *x4, const uint8_t *msg, size_t len,
+                          const uint8_t *expected, size_t out_len) {
+    static uint8_t copies[3][SHAKE_X4_MAX_MSG];
+    static uint8_t computed[4][SHAKE_X4_MAX_OUT];
+    static uint8_t reference[SHAKE_X4_MAX_OUT];
+    size_t blocks = (out_len + x4->rate - 1) / x4->rate;
+    if (len > SHAKE_X4_MAX_MSG || blocks * x4->rate > SHAKE_X4_MAX_OUT) {
+        return 1;
+    }
+
+    const uint8_t *in[4] = {msg, msg, msg, msg};
+    for (size_t l = 1; len > 0 && l < 4; l++) {
+        memcpy(copies[l - 1], msg, len);
+        copies[l - 1][(l * 97) % len] ^= (uint8_t)(1u << l);
+        in[l] = copies[l - 1];
+    }
+
+    nano_shake_x4_ctx ctx;
+    uint8_t *out[4] = {computed[0], computed[1], computed[2], computed[3]};
+    x4->absorb(&ctx, in, len);
+    x4->squeezeblocks(&ctx, out, blocks > 0 ? 1 : 0);
+    if (blocks > 1) {
+        for (size_t l = 0; l < 4; l++) {
+            out[l] += x4->rate;
+        }
+        x4->squeezeblocks(&ctx, out, blocks - 1);
+    }
+
+    int ok = memcmp(computed[0], expected, out_len) == 0;
+    for (size_t l = 1; l < 4; l++) {
+        v->oneshot(reference, out_len, in[l], len);
+        ok = ok && memcmp(computed[l], reference, out_len) == 0;
+    }
+    return ok;
+}
+#endif
+
+// Check one SHAKE vector one-shot and incrementally: input absorbed and
+// output squeezed in chunks of STREAM_CHUNKS[rotation], then a late absorb
+// must be refused (and through the 4-way API on the multi-buffer
+// libraries). computed is out_len bytes of scratch.
+static int check_shake(const ShakeVariant *v, const uint8_t *msg, size_t len,
+                       const uint8_t *expected, size_t out_len, size_t rotation,
+                       uint8_t *computed) {
+    v->oneshot(computed, out_len, msg, len);
+    int ok = memcmp(computed, expected, out_len) == 0;
+
+    nano_shake_ctx ctx;
+    size_t chunk = STREAM_CHUNKS[rotation % STREAM_CHUNK_COUNT];
+    v->init(&ctx);
+    for (size_t off = 0; off < len; off += chunk) {
+        v->absorb(&ctx, msg + off, (len - off < chunk) ? len - off : chunk);
+    }
+    memset(computed, 0, out_len);
+    chunk = STREAM_CHUNKS[(rotation + 1) % STREAM_CHUNK_COUNT];
+    for (size_t off = 0; off < out_len; off += chunk) {
+        v->squeeze(&ctx, computed + off, (out_len - off < chunk) ? out_len - off : chunk);
+    }
+    ok = ok && memcmp(computed, expected, out_len) == 0;
+#ifdef HAVE_MULTIBUF
+    ok = ok && check_shake_x4(v, v == &SHAKE128 ? &SHAKE128_X4 : &SHAKE256_X4, msg, len, expected, out_len);
+#endif
+    return ok && v->absorb(&ctx, msg, len) == -1;
+}
+
+// Run a CAVS-layout SHAKE file (ShortMsg/LongMsg with [Outputlen = ...],
+// VariableOut with a per-vector Outputlen); Output closes each record
+int run_shake(const char *filename, const ShakeVariant *v, const char *test_name,
+              size_t *passed, size_t *failed) {
+    RspFile f;
+    if (rsp_open(&f, filename) != 0) {
+        return -1;
+    }
+
+    const char *line, *value;
+    size_t line_len, n;
+    size_t len = 0, out_bits = 0, count = 0;
+    const uint8_t *msg = NULL;
+
+    *passed = 0;
+    *failed = 0;
+
+    while (rsp_line(&f, &line, &line_len)) {
+        if ((value = rsp_field(line, line_len, "[Outputlen = ", &n)) != NULL ||
+            (value = rsp_field(line, line_len, "Outputlen = ", &n)) != NULL) {
+            out_bits = rsp_number(value, n);
+        } else if ((value = rsp_field(line, line_len, "[Input Length = ", &n)) != NULL ||
+                   (value = rsp_field(line, line_len, "Len = ", &n)) != NULL) {
+            len = rsp_number(value, n) / 8;
+        } else if ((value = rsp_field(line, line_len, "Msg = ", &n)) != NULL) {
+            size_t msg_len = 0;
+            msg = NULL;
+            if (len > 0 && ((msg = rsp_hex(&f, value, n, &msg_len)) == NULL || msg_len != len)) {
+                printf("ERROR: Failed to parse %s message (Len=%zu)\n", test_name, len * 8);
+                rsp_close(&f);
+                return -1;
+            }
+        } else if ((value = rsp_field(line, line_len, "Output = ", &n)) != NULL) {
+            size_t mark = f.arena_used;
+            size_t out_len = 0;
+            const uint8_t *expected = rsp_hex(&f, value, n, &out_len);
+            uint8_t *computed = expected ? rsp_alloc(&f, out_len) : NULL;
+            if (!computed || out_len * 8 != out_bits) {
+                printf("ERROR: Invalid %s output for Outputlen=%zu\n", test_name, out_bits);
+                rsp_close(&f);
+                return -1;
+            }
+            if (check_shake(v, msg, len, expected, out_len, count, computed)) {
+                (*passed)++;
+            } else {
+                (*failed)++;
+                printf("FAIL: %s Vector %zu (Len=%zu, Outputlen=%zu)\n", test_name, count + 1, len * 8, out_bits);
+            }
+            count++;
+            f.arena_used = mark;
+        }
+    }
+
+    rsp_close(&f);
+    printf("Running %s validation: %zu vectors\n", test_name, count);
+    return 0;
+}
+
+// KMAC256 vectors (KeyLen, Key, S, Len, Msg, L, MAC records, MAC closes each)
+// Each frame is MACed twice from one keyed context (it must stay unchanged)
+// and once incrementally through a clone in STREAM_CHUNKS pieces.
+int run_kmac(const char *filename, size_t *passed, size_t *failed) {
+    RspFile f;
+    if (rsp_open(&f, filename) != 0) {
+        return -1;
+    }
+
+    const char *line, *value;
+    size_t line_len, n;
+    size_t key_len = 0, len = 0, out_bits = 0, count = 0;
+    char custom[256] = {0};
+    const uint8_t *key = NULL, *msg = NULL;
+
+    *passed = 0;
+    *failed = 0;
+
+    while (rsp_line(&f, &line, &line_len)) {
+        if ((value = rsp_field(line, line_len, "KeyLen = ", &n)) != NULL) {
+            key_len = rsp_number(value, n) / 8;
+        } else if ((value = rsp_field(line, line_len, "Key = ", &n)) != NULL) {
+            size_t parsed = 0;
+            key = NULL;
+            if (key_len > 0 && ((key = rsp_hex(&f, value, n, &parsed)) == NULL || parsed != key_len)) {
+                printf("ERROR: Failed to parse KMAC256 key (KeyLen=%zu)\n", key_len * 8);
+                rsp_close(&f);
+                return -1;
+            }
+        } else if ((value = rsp_field(line, line_len, "S = \"", &n)) != NULL) {
+            rsp_string(value, n, custom, sizeof(custom));
+        } else if ((value = rsp_field(line, line_len, "Len = ", &n)) != NULL) {
+            len = rsp_number(value, n) / 8;
+        } else if ((value = rsp_field(line, line_len, "Msg = ", &n)) != NULL) {
+            size_t parsed = 0;
+            msg = NULL;
+            if (len > 0 && ((msg = rsp_hex(&f, value, n, &parsed)) == NULL || parsed != len)) {
+                printf("ERROR: Failed to parse KMAC256 message (Len=%zu)\n", len * 8);
+                rsp_close(&f);
+                return -1;
+            }
+        } else if ((value = rsp_field(line, line_len, "L = ", &n)) != NULL) {
+            out_bits = rsp_number(value, n);
+        } else if ((value = rsp_field(line, line_len, "MAC = ", &n)) != NULL) {
+            size_t mark = f.arena_used;
+            size_t mac_len = 0;
+            const uint8_t *mac = rsp_hex(&f, value, n, &mac_len);
+            uint8_t *computed = mac ? rsp_alloc(&f, mac_len) : NULL;
+            if (!computed || mac_len * 8 != out_bits) {
+                printf("ERROR: Invalid KMAC256 MAC for L=%zu\n", out_bits);
+                rsp_close(&f);
+                return -1;
+            }
+
+            nano_kmac256_ctx keyed, frame;
+            int ok = 1;
+            nano_kmac256_init(&keyed, key, key_len, (const uint8_t *)custom, strlen(custom));
+            for (int pass = 0; ok && pass < 2; pass++) {
+                nano_kmac256(computed, mac_len, &keyed, msg, len);
+                ok = memcmp(computed, mac, mac_len) == 0;
+            }
+            if (ok) {
+                size_t chunk = STREAM_CHUNKS[count % STREAM_CHUNK_COUNT];
+                nano_kmac256_clone(&frame, &keyed);
+                for (size_t off = 0; off < len; off += chunk) {
+                    nano_kmac256_update(&frame, msg + off, (len - off < chunk) ? len - off : chunk);
+                }
+                nano_kmac256_final(&frame, computed, mac_len);
+                ok = memcmp(computed, mac, mac_len) == 0;
+            }
+            count++;
+            if (ok) {
+                (*passed)++;
+            } else {
+                (*failed)++;
+                printf("FAIL: KMAC256 Vector %zu (KeyLen=%zu, S=\"%s\", Len=%zu, L=%zu)\n",
+                       count, key_len * 8, custom, len * 8, out_bits);
+            }
+            f.arena_used = mark;
+        }
+    }
+
+    rsp_close(&f);
+    printf("Running KMAC256 validation: %zu vectors\n", count);
+    return 0;
+}
+
+#ifdef HAVE_MULTIBUF
+// ParallelHash256 vectors (B, S, Len, Msg, L, MD records, MD closes each one)
+// Every vector is hashed with 1, 3 and all available threads.
+static const size_t PARALLEL_THREADS[] = {1, 3, 0};
+
+int run_parallelhash(const char *filename, size_t *passed, size_t *failed) {
+    RspFile f;
+    if (rsp_open(&f, filename) != 0) {
+        return -1;
+    }
+
+    const char *line, *value;
+    size_t line_len, n;
+    size_t block_size = 0, len = 0, out_bits = 0, count = 0;
+    char custom[256] = {0};
+    const uint8_t *msg = NULL;
+
+    *passed = 0;
+    *failed = 0;
+
+    while (rsp_line(&f, &line, &line_len)) {
+        if ((value = rsp_field(line, line_len, "B = ", &n)) != NULL) {
+            block_size = rsp_number(value, n);
+        } else if ((value = rsp_field(line, line_len, "S = \"", &n)) != NULL) {
+            rsp_string(value, n, custom, sizeof(custom));
+        } else if ((value = rsp_field(line, line_len, "Len = ", &n)) != NULL) {
+            len = rsp_number(value, n) / 8;
+        } else if ((value = rsp_field(line, line_len, "Msg = ", &n)) != NULL) {
+            size_t msg_len = 0;
+            msg = NULL;
+            if (len > 0 && ((msg = rsp_hex(&f, value, n, &msg_len)) == NULL || msg_len != len)) {
+                printf("ERROR: Failed to parse ParallelHash256 message (Len=%zu)\n", len * 8);
+                rsp_close(&f);
+                return -1;
+            }
+        } else if ((value = rsp_field(line, line_len, "L = ", &n)) != NULL) {
+            out_bits = rsp_number(value, n);
+        } else if ((value = rsp_field(line, line_len, "MD = ", &n)) != NULL) {
+            size_t mark = f.arena_used;
+            size_t md_len = 0;
+            const uint8_t *md = rsp_hex(&f, value, n, &md_len);
+            uint8_t *computed = md ? rsp_alloc(&f, md_len) : NULL;
+            if (!computed || md_len * 8 != out_bits) {
+                printf("ERROR: Invalid ParallelHash256 MD for L=%zu\n", out_bits);
+                rsp_close(&f);
+                return -1;
+            }
+            count++;
+
+            int ok = 1;
+            for (size_t t = 0; ok && t < sizeof(PARALLEL_THREADS) / sizeof(PARALLEL_THREADS[0]); t++) {
+                ok = nano_parallelhash256(computed, md_len, msg, len, block_size,
+                                          (const uint8_t *)custom, strlen(custom),
+                                          PARALLEL_THREADS[t]) == 0 &&
+                     memcmp(computed, md, md_len) == 0;
+                if (!ok) {
+                    printf("FAIL: ParallelHash256 Vector %zu (B=%zu, S=\"%s\", Len=%zu, threads=%zu)\n",
+                           count, block_size, custom, len * 8, PARALLEL_THREADS[t]);
+                }
+            }
+            if (ok) {
+                (*passed)++;
+            } else {
+                (*failed)++;
+            }
+            f.arena_used = mark;
+        }
+    }
+
+    rsp_close(&f);
+    printf("ParallelHash256 validation: %zu vectors x %zu thread counts\n", count,
+           sizeof(PARALLEL_THREADS) / sizeof(PARALLEL_THREADS[0]));
+    return 0;
+}
+#endif
+
+// SHA3VS Monte Carlo (Msg = Seed, then COUNT/MD checkpoints): MD[0] = Seed,
+// MD[i] = SHA3-256(MD[i-1]) for i = 1..1000, and MD[1000] is both the
+// checkpoint and the next seed. All 100,000 chained hashes run through one
+// streaming context, re-initialised after every final, with each 32-byte
+// message split across two updates at a rotating offset (0..32). The hash
+// loop is timed on its own as a sustained-throughput figure. A second chain
+// runs the constant-length header-only one-shot and must match every
+// checkpoint too.
+#define MONTE_ITERATIONS 1000
+
+int run_monte(const char *filename, size_t *passed, size_t *failed, double *ns_per_hash,
+              double *inline_ns_per_hash) {
+    RspFile f;
+    if (rsp_open(&f, filename) != 0) {
+        return -1;
+    }
+
+    const char *line, *value;
+    size_t line_len, n;
+    uint8_t md[32], md_inline[32];
+    int seeded = 0;
+    size_t count = 0;
+    double elapsed_ns = 0, inline_elapsed_ns = 0;
+    nano_sha3_256_ctx ctx;
+
+    *passed = 0;
+    *failed = 0;
+
+    while (rsp_line(&f, &line, &line_len)) {
+        if ((value = rsp_field(line, line_len, "Msg = ", &n)) != NULL) {
+            size_t seed_len = 0;
+            const uint8_t *seed = rsp_hex(&f, value, n, &seed_len);
+            if (!seed || seed_len != 32) {
+                printf("ERROR: Invalid Monte Carlo seed\n");
+                rsp_close(&f);
+                return -1;
+            }
+            memcpy(md, seed, 32);
+            memcpy(md_inline, seed, 32);
+            seeded = 1;
+        } else if ((value = rsp_field(line, line_len, "MD = ", &n)) != NULL) {
+            size_t mark = f.arena_used;
+            size_t md_len = 0;
+            const uint8_t *expected = rsp_hex(&f, value, n, &md_len);
+            if (!seeded || !expected || md_len != 32) {
+                printf("ERROR: Invalid Monte Carlo checkpoint %zu\n", count);
+                rsp_close(&f);
+                return -1;
+            }
+
+            struct timespec t0, t1;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            for (size_t i = 1; i <= MONTE_ITERATIONS; i++) {
+                size_t split = (count * MONTE_ITERATIONS + i) % 33;
+                nano_sha3_256_init(&ctx);
+                nano_sha3_256_update(&ctx, md, split);
+                nano_sha3_256_update(&ctx, md + split, 32 - split);
+                nano_sha3_256_final(&ctx, md);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            elapsed_ns += (double)(t1.tv_sec - t0.tv_sec) * 1e9 + (double)(t1.tv_nsec - t0.tv_nsec);
+
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            for (size_t i = 1; i <= MONTE_ITERATIONS; i++) {
+                nano_sha3_256_inline(md_inline, md_inline, 32);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            inline_elapsed_ns += (double)(t1.tv_sec - t0.tv_sec) * 1e9 + (double)(t1.tv_nsec - t0.tv_nsec);
+
+            if (memcmp(md, expected, 32) == 0 && memcmp(md_inline, expected, 32) == 0) {
+                (*passed)++;
+            } else {
+                char computed_hex[65], inline_hex[65];
+                bytes_to_hex(md, 32, computed_hex);
+                bytes_to_hex(md_inline, 32, inline_hex);
+                printf("FAIL: Monte Carlo COUNT = %zu: %s (inline %s)\n", count, computed_hex, inline_hex);
+                (*failed)++;
+            }
+            count++;
+            f.arena_used = mark;
+        }
+    }
+
+    rsp_close(&f);
+    *ns_per_hash = count ? elapsed_ns / (double)(count * MONTE_ITERATIONS) : 0;
+    *inline_ns_per_hash = count ? inline_elapsed_ns / (double)(count * MONTE_ITERATIONS) : 0;
+    printf("Running Monte Carlo validation: %zu checkpoints x %d chained hashes\n", count, MONTE_ITERATIONS);
+    return 0;
+}
+
+// Run validation on test vectors
+int run_validation(const char *filename, const char *test_name, size_t *passed, size_t *failed) {
+    RspFile f;
+    TestVector *vectors;
+    size_t count;
+    
+    if (rsp_open(&f, filename) != 0) {
+        return -1;
+    }
+    if (parse_test_vectors(&f, &vectors, &count) != 0) {
+        rsp_close(&f);
+        return -1;
+    }
+    
+    printf("Running %s validation: %zu vectors\n", test_name, count);
+    
+    *passed = 0;
+    *failed = 0;
+    
+    // Multi-buffer and per-kernel results per vector (all OK where the API does not exist)
+    int *multibuf_ok = (int *)rsp_alloc(&f, (count ? count : 1) * sizeof(int));
+    if (!multibuf_ok) {
+        rsp_close(&f);
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        multibuf_ok[i] = 1;
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    if (count > 0) {
+        check_multibuf(vectors, count, 4, test_name, multibuf_ok);
+        check_multibuf(vectors, count, 8, test_name, multibuf_ok);
+        printf("  %s multi-buffer x4/x8 lanes checked\n", test_name);
+    }
+#elif defined(HAVE_MULTIBUF_X2)
+    if (count > 0) {
+        check_multibuf(vectors, count, 2, test_name, multibuf_ok);
+        printf("  %s multi-buffer x2 lanes checked\n", test_name);
+    }
+#endif
+#ifdef HAVE_KERNELS
+    if (count > 0) {
+        check_kernels(vectors, count, test_name, multibuf_ok);
+    }
+#endif
+#ifdef HAVE_MULTIBUF
+    if (count > 0) {
+        if (check_batch(&f, vectors, count, test_name, multibuf_ok) != 0) {
+            rsp_close(&f);
+            return -1;
+        }
+        printf("  %s batch (1 and 4 workers) checked\n", test_name);
+    }
+#endif
+    
+    for (size_t i = 0; i < count; i++) {
+        uint8_t computed_hash[32];
+        
+        // Call the static library function (len is in bits, convert to bytes)
+        // Handle empty message case (Len=0)
+        if (vectors[i].len == 0) {
+            uint8_t empty_msg = 0;
+            nano_sha3_256(computed_hash, &empty_msg, 0);
+        } else {
+            nano_sha3_256(computed_hash, vectors[i].msg, vectors[i].len / 8);
+        }
+        
+        // Same vector through the streaming API, rotating the chunk size
+        uint8_t streamed_hash[32];
+        size_t chunk = STREAM_CHUNKS[i % STREAM_CHUNK_COUNT];
+        hash_streaming(streamed_hash, vectors[i].msg, vectors[i].len / 8, chunk);
+        
+        // And as a scatter-gather list split at random fragment points
+        uint8_t iov_hash[32];
+        hash_iov(iov_hash, vectors[i].msg, vectors[i].len / 8, (uint32_t)i);
+        
+        // And through the bounded-work step API
+        uint8_t stepped_hash[32];
+        hash_stepped(stepped_hash, vectors[i].msg, vectors[i].len / 8);
+        
+        // And through the header-only implementation (one-shot and chunked)
+        uint8_t inline_hash[32];
+        int inline_ok = hash_inline(inline_hash, vectors[i].msg, vectors[i].len / 8, chunk);
+        
+        // And from a midstate over the first half (plus a cloned context)
+        uint8_t midstate_hash[32];
+        int midstate_ok = hash_midstate(midstate_hash, vectors[i].msg, vectors[i].len / 8);
+        
+        // Same vector in DMA-sized chunks through the ping-pong API
+        size_t dma_failed_half = 0;
+        for (size_t h = 0; h < sizeof(DMA_HALVES) / sizeof(DMA_HALVES[0]); h++) {
+            uint8_t dma_hash[32];
+            hash_dma(dma_hash, vectors[i].msg, vectors[i].len / 8, DMA_HALVES[h]);
+            if (memcmp(dma_hash, vectors[i].md, 32) != 0) {
+                dma_failed_half = DMA_HALVES[h];
+            }
+        }
+        
+        // 64-byte vectors also go through the Merkle node kernel
+        if (vectors[i].len == 512) {
+            uint8_t node_hash[32];
+            nano_sha3_256_node64(node_hash, vectors[i].msg);
+            if (memcmp(node_hash, vectors[i].md, 32) != 0) {
+                printf("FAIL: %s Vector %zu (Len=512) via nano_sha3_256_node64\n", test_name, i + 1);
+                multibuf_ok[i] = 0;
+            }
+            nano_sha3_256_inline_node64(node_hash, vectors[i].msg);
+            if (memcmp(node_hash, vectors[i].md, 32) != 0) {
+                printf("FAIL: %s Vector %zu (Len=512) via nano_sha3_256_inline_node64\n", test_name, i + 1);
+                multibuf_ok[i] = 0;
+            }
+        }
+        
+        if (memcmp(computed_hash, vectors[i].md, 32) == 0 &&
+            memcmp(streamed_hash, vectors[i].md, 32) == 0 &&
+            memcmp(stepped_hash, vectors[i].md, 32) == 0 &&
+            memcmp(iov_hash, vectors[i].md, 32) == 0 &&
+            memcmp(inline_hash, vectors[i].md, 32) == 0 && inline_ok &&
+            memcmp(midstate_hash, vectors[i].md, 32) == 0 && midstate_ok &&
+            dma_failed_half == 0 && multibuf_ok[i]) {
+            (*passed)++;
+        } else {
+            (*failed)++;
+            printf("FAIL: %s Vector %zu (Len=%zu)\n", test_name, i + 1, vectors[i].len);
+            
+            char expected_hex[65], computed_hex[65];
+            bytes_to_hex(vectors[i].md, 32, expected_hex);
+            bytes_to_hex(computed_hash, 32, computed_hex);
+            
+            printf("  Expected: %s\n", expected_hex);
+            printf("  Got:      %s\n", computed_hex);
+            bytes_to_hex(streamed_hash, 32, computed_hex);
+            printf("  Stream:   %s (chunk=%zu)\n", computed_hex, chunk);
+            bytes_to_hex(stepped_hash, 32, computed_hex);
+            printf("  Stepped:  %s\n", computed_hex);
+            bytes_to_hex(iov_hash, 32, computed_hex);
+            printf("  Iovec:    %s\n", computed_hex);
+            bytes_to_hex(inline_hash, 32, computed_hex);
+            printf("  Inline:   %s%s\n", computed_hex, inline_ok ? "" : " (chunked differs)");
+            bytes_to_hex(midstate_hash, 32, computed_hex);
+            printf("  Midstate: %s%s\n", computed_hex, midstate_ok ? "" : " (clone differs)");
+            if (dma_failed_half) {
+                printf("  DMA:      differs with %zu-byte halves\n", dma_failed_half);
+            }
+            
+            if (vectors[i].msg && vectors[i].len > 0) {
+                char *input_hex = malloc(vectors[i].len / 4 + 1);
+                if (input_hex) {
+                    bytes_to_hex(vectors[i].msg, vectors[i].len / 8, input_hex);
+                    printf("  Input:    %s\n", input_hex);
+                    free(input_hex);
+                }
+            }
+        }
+        
+        // Progress indicator
+        if ((i + 1) % 25 == 0) {
+            printf("  %s processed %zu vectors...\n", test_name, i + 1);
+        }
+    }
+    
+    // Vectors, messages and flags all live in the file's arena
+    rsp_close(&f);
+    
+    return 0;
+}
+
+int main() {
+    printf("NIST SHA3-256 Static Library Validation\n");
+    printf("=======================================\n");
+    printf("Testing 237 critical NIST CAVS 19.0 test vectors\n");
+    printf("Using actual customer static library (.a file)\n");
+    printf("Each vector checked via one-shot, streaming (init/update/final), step and\n");
+    printf("prefix-midstate/clone APIs, and the header-only nano_sha3_256_inline.h\n");
+#if defined(__x86_64__) || defined(_M_X64)
+    printf("plus 4-lane (AVX2) and 8-lane (AVX-512) multi-buffer APIs\n");
+    printf("and every supported permutation kernel (scalar, bmi2, avx512)\n");
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    printf("plus 2-lane (ARMv8.2-SHA3) multi-buffer API\n");
+    printf("and every supported permutation kernel (scalar, sha3)\n");
+#elif defined(HAVE_MULTIBUF_X2)
+    printf("plus 2-lane (NEON) multi-buffer API\n");
+#endif
+    printf("SHAKE128/256 XOF vectors (ShortMsg, LongMsg, VariableOut) checked separately\n");
+    printf("plus the 100,000-hash SHA3-256 Monte Carlo chain on one streaming context\n");
+    printf("\n");
+    
+    size_t total_passed = 0, total_failed = 0;
+    size_t passed, failed;
+    
+    // Test 1: Short Message vectors (137 vectors)
+    if (run_validation("../../ci-evidence/test_data_nist/SHA3_256ShortMsg.rsp", "ShortMsg", &passed, &failed) == 0) {
+        total_passed += passed;
+        total_failed += failed;
+        printf("  ShortMsg: %zu passed, %zu failed\n", passed, failed);
+    } else {
+        printf("ERROR in ShortMsg validation\n");
+        return 1;
+    }
+    
+    // Test 2: Long Message vectors (100 vectors)
+    if (run_validation("../../ci-evidence/test_data_nist/SHA3_256LongMsg.rsp", "LongMsg", &passed, &failed) == 0) {
+        total_passed += passed;
+        total_failed += failed;
+        printf("  LongMsg:  %zu passed, %zu failed\n", passed, failed);
+    } else {
+        printf("ERROR in LongMsg validation\n");
+        return 1;
+    }
+
+    // Merkle node level against the one-shot (the node64 path itself is
+    // covered by the 512-bit ShortMsg vector above)
+    if (!check_node64_level()) {
+        printf("\n");
+        printf("FAILURE: nano_sha3_256_node64_many mismatch\n");
+        return 1;
+    }
+    printf("  Merkle node level (%d nodes, separate and in place): passed\n", NODE_LEVEL);
+
+#ifdef HAVE_KERNELS
+    if (!check_checkpoint()) {
+        printf("\n");
+        printf("FAILURE: context checkpoint mismatch\n");
+        return 1;
+    }
+    printf("  Context checkpoints (export, import, resume, damaged images): passed\n");
+#endif
+
+#ifdef NANO_SHA3_256_COUNTERS
+    // Hot-path counters, only in libraries built with the feature
+    if (!check_counters()) {
+        printf("\n");
+        printf("FAILURE: hot-path counters mismatch\n");
+        return 1;
+    }
+    printf("  Hot-path counters (per context, clone, final, library-wide): passed\n");
+#endif
+
+    // SHA3VS Monte Carlo chain, reported apart from the SHA3-256 CAVS count
+    size_t monte_passed, monte_failed;
+    double monte_ns, monte_inline_ns;
+    if (run_monte("../../ci-evidence/test_data_nist/SHA3_256Monte.rsp", &monte_passed, &monte_failed,
+                  &monte_ns, &monte_inline_ns) == 0) {
+        printf("  Monte Carlo: %zu passed, %zu failed (%.1f ns/hash, %.2f MB/s sustained on 32-byte messages)\n",
+               monte_passed, monte_failed, monte_ns, monte_ns > 0 ? 32e3 / monte_ns : 0.0);
+        printf("  Monte Carlo (header-only, constant length): %.1f ns/hash\n", monte_inline_ns);
+    } else {
+        printf("ERROR in Monte Carlo validation\n");
+        return 1;
+    }
+    if (monte_failed > 0) {
+        printf("\n");
+        printf("FAILURE: %zu Monte Carlo checkpoints failed\n", monte_failed);
+        return 1;
+    }
+
+    // SHAKE128 / SHAKE256 XOFs, reported apart from the SHA3-256 CAVS count
+    static const struct {
+        const char *file;
+        const ShakeVariant *variant;
+        const char *name;
+    } shake_files[] = {
+        {"../../ci-evidence/test_data_nist/SHAKE128ShortMsg.rsp", &SHAKE128, "SHAKE128 ShortMsg"},
+        {"../../ci-evidence/test_data_nist/SHAKE128LongMsg.rsp", &SHAKE128, "SHAKE128 LongMsg"},
+        {"../../ci-evidence/test_data_nist/SHAKE128VariableOut.rsp", &SHAKE128, "SHAKE128 VariableOut"},
+        {"../../ci-evidence/test_data_nist/SHAKE256ShortMsg.rsp", &SHAKE256, "SHAKE256 ShortMsg"},
+        {"../../ci-evidence/test_data_nist/SHAKE256LongMsg.rsp", &SHAKE256, "SHAKE256 LongMsg"},
+        {"../../ci-evidence/test_data_nist/SHAKE256VariableOut.rsp", &SHAKE256, "SHAKE256 VariableOut"},
+    };
+    size_t shake_passed = 0, shake_failed = 0;
+    for (size_t f = 0; f < sizeof(shake_files) / sizeof(shake_files[0]); f++) {
+        if (run_shake(shake_files[f].file, shake_files[f].variant, shake_files[f].name, &passed, &failed) != 0) {
+            printf("ERROR in %s validation\n", shake_files[f].name);
+            return 1;
+        }
+        shake_passed += passed;
+        shake_failed += failed;
+    }
+    printf("  SHAKE128/256: %zu passed, %zu failed\n", shake_passed, shake_failed);
+    if (shake_failed > 0) {
+        printf("\n");
+        printf("FAILURE: %zu SHAKE vectors failed\n", shake_failed);
+        return 1;
+    }
+
+    // KMAC256 (SP 800-185), reported apart from the SHA3-256 CAVS count
+    size_t kmac_passed, kmac_failed;
+    if (run_kmac("../../ci-evidence/test_data_nist/KMAC256.rsp", &kmac_passed, &kmac_failed) == 0) {
+        printf("  KMAC256: %zu passed, %zu failed\n", kmac_passed, kmac_failed);
+    } else {
+        printf("ERROR in KMAC256 validation\n");
+        return 1;
+    }
+    if (kmac_failed > 0) {
+        printf("\n");
+        printf("FAILURE: %zu KMAC256 vectors failed\n", kmac_failed);
+        return 1;
+    }
+
+#ifdef HAVE_MULTIBUF
+    // ParallelHash256 (SP 800-185), reported apart from the SHA3-256 CAVS count
+    size_t parallel_passed, parallel_failed;
+    if (run_parallelhash("../../ci-evidence/test_data_nist/ParallelHash256.rsp",
+                         &parallel_passed, &parallel_failed) == 0) {
+        printf("  ParallelHash256: %zu passed, %zu failed\n", parallel_passed, parallel_failed);
+    } else {
+        printf("ERROR in ParallelHash256 validation\n");
+        return 1;
+    }
+    if (parallel_failed > 0) {
+        printf("\n");
+        printf("FAILURE: %zu ParallelHash256 vectors failed\n", parallel_failed);
+        return 1;
+    }
+#endif
+
+    printf("\n");
+    printf("Overall Validation Results:\n");
+    printf("  Total Passed: %zu\n", total_passed);
+    printf("  Total Failed: %zu\n", total_failed);
+    printf("  Total Tests:  %zu\n", total_passed + total_failed);
+    
+    if (total_failed > 0) {
+        printf("\n");
+        printf("FAILURE: %zu test vectors failed\n", total_failed);
+        return 1;
+    } else {
+        printf("\n");
+        printf("SUCCESS: All %zu critical NIST test vectors passed\n", total_passed);
+        printf("✓ ShortMsg validation complete (137 vectors)\n");
+        printf("✓ LongMsg validation complete (100 vectors)\n");
+        printf("✓ Monte Carlo chain complete (100 checkpoints, 100,000 hashes)\n");
+        return 0;
+    }
+}
\ No newline at end of file
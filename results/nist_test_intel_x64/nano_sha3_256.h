@@ -11,14 +11,455 @@
 extern "C" {
 #endif
 
+// Size in bytes of the opaque streaming context storage
+// Libraries built with the "counters" feature keep a 48-byte tally after the
+// hash state: define NANO_SHA3_256_COUNTERS before including this header
+// when linking one (and only then), so every context is allocated that size.
+// Such libraries export the context functions under *_counters names, which
+// the macros below select, so a header/library mismatch fails to link.
+#ifdef NANO_SHA3_256_COUNTERS
+#define NANO_SHA3_256_CTX_SIZE 400
+#define nano_sha3_256_init nano_sha3_256_init_counters
+#define nano_sha3_256_update nano_sha3_256_update_counters
+#define nano_sha3_256_update_step nano_sha3_256_update_step_counters
+#define nano_sha3_256_final nano_sha3_256_final_counters
+#define nano_sha3_256_clone nano_sha3_256_clone_counters
+#define nano_sha3_256_prefix nano_sha3_256_prefix_counters
+#define nano_sha3_256_from_midstate nano_sha3_256_from_midstate_counters
+#define nano_sha3_256_export nano_sha3_256_export_counters
+#define nano_sha3_256_import nano_sha3_256_import_counters
+#define nano_sha3_256_dma_init nano_sha3_256_dma_init_counters
+#define nano_sha3_256_dma_absorb_half nano_sha3_256_dma_absorb_half_counters
+#define nano_sha3_256_dma_final nano_sha3_256_dma_final_counters
+#else
+#define NANO_SHA3_256_CTX_SIZE 352
+#endif
+
+// Streaming SHA3-256 context (wraps the Rust Sha3_256Context)
+// Caller-allocated (stack or static), never touches the heap.
+// Treat as opaque: only access through the functions below.
+typedef struct {
+    uint64_t opaque[NANO_SHA3_256_CTX_SIZE / 8];
+} nano_sha3_256_ctx;
+
 // Single-call SHA3-256 hash function
 // @param out: output buffer (must be 32 bytes)
 // @param input: input data to hash
 // @param len: length of input data in bytes
 void nano_sha3_256(uint8_t *out, const uint8_t *input, size_t len);
 
+// Initialize a streaming context
+// @param ctx: caller-allocated context (overwritten)
+void nano_sha3_256_init(nano_sha3_256_ctx *ctx);
+
+// Absorb the next chunk of input
+// @param ctx: context initialized with nano_sha3_256_init
+// @param input: input data chunk (may be NULL when len is 0)
+// @param len: length of chunk in bytes
+void nano_sha3_256_update(nano_sha3_256_ctx *ctx, const uint8_t *input, size_t len);
+
+// Finish the hash and write the digest
+// @param ctx: context to finalize (wiped; call init again before reuse)
+// @param out: output buffer (must be 32 bytes)
+void nano_sha3_256_final(nano_sha3_256_ctx *ctx, uint8_t *out);
+
+// Status returned by nano_sha3_256_update_step
+#define NANO_SHA3_256_DONE 0  // All input absorbed
+#define NANO_SHA3_256_MORE 1  // Input remains, call again with the rest
+
+// Absorb input with bounded work per call (cooperative schedulers, RTOS tasks)
+// Takes at most one rate block (136 bytes), so each call runs at most one
+// Keccak-f[1600] permutation. Same constant-time and stack bounds as update.
+// @param ctx: context initialized with nano_sha3_256_init
+// @param input: input data (may be NULL when len is 0)
+// @param len: length of remaining input in bytes
+// @param consumed: set to the number of bytes absorbed by this call
+// @return NANO_SHA3_256_MORE if *consumed < len, else NANO_SHA3_256_DONE
+int nano_sha3_256_update_step(nano_sha3_256_ctx *ctx, const uint8_t *input, size_t len, size_t *consumed);
+
+// Copy a streaming context (fork a hash after a shared prefix)
+// Both contexts then continue independently. Only the live context is
+// copied, no permutation runs.
+// @param dst: destination context (overwritten; may equal src)
+// @param src: initialized context
+void nano_sha3_256_clone(nano_sha3_256_ctx *dst, const nano_sha3_256_ctx *src);
+
+// Absorb a fixed prefix (domain tag, serialized header) into a midstate
+// Pay for the prefix once, then hash each message from the saved state with
+// nano_sha3_256_from_midstate. Prefixes of a multiple of 136 bytes leave no
+// buffered bytes behind, so every message starts on a block boundary.
+// @param midstate: caller-allocated context (overwritten)
+// @param prefix: prefix bytes (may be NULL when len is 0)
+// @param len: prefix length in bytes
+void nano_sha3_256_prefix(nano_sha3_256_ctx *midstate, const uint8_t *prefix, size_t len);
+
+// SHA3-256(prefix || input) from a midstate, which is left unchanged
+// @param out: output buffer (must be 32 bytes)
+// @param midstate: context from nano_sha3_256_prefix (or any initialized context)
+// @param input: message bytes after the prefix (may be NULL when len is 0)
+// @param len: message length in bytes
+void nano_sha3_256_from_midstate(uint8_t *out, const nano_sha3_256_ctx *midstate, const uint8_t *input, size_t len);
+
+// Size in bytes of a streaming context checkpoint
+#define NANO_SHA3_256_EXPORT_SIZE 216
+
+// Checkpoint a streaming context (resume a long hash after a reset)
+// Writes a fixed, little-endian, versioned image: magic "NS3C", version 1,
+// a reserved 0 byte, the bytes pending toward the next block (u16), the
+// 200-byte Keccak state with those bytes XORed in, and an 8-byte SHA3-256
+// check over the rest. Independent of the library's context layout, so
+// persist it to flash and import it in any build. Not in the libraries that
+// wrap the core crate (cortex_m0/m4/m33, arm_linux): use their _fast,
+// _lowram or _asm variant.
+// @param ctx: initialized context (unchanged)
+// @param out: NANO_SHA3_256_EXPORT_SIZE bytes (any alignment)
+void nano_sha3_256_export(const nano_sha3_256_ctx *ctx, uint8_t *out);
+
+// Resume hashing from a checkpoint: continue with nano_sha3_256_update at
+// the message byte after the one the checkpoint was taken at
+// The check rejects torn or erased writes, it does not authenticate the
+// image. Counters of a "counters" build restart from zero.
+// @param ctx: caller-allocated context (overwritten on success only)
+// @param input: NANO_SHA3_256_EXPORT_SIZE bytes from nano_sha3_256_export
+// @return 0 on success, -1 if the magic, version, length or check is wrong
+int nano_sha3_256_import(nano_sha3_256_ctx *ctx, const uint8_t *input);
+
+// One fragment of a scatter-gather message (a buffer in a packet chain)
+struct nano_sha3_iov {
+    const uint8_t *base;  // fragment bytes (may be NULL when len is 0)
+    size_t len;           // fragment length in bytes
+};
+
+// SHA3-256 of n fragments hashed back to back, without a contiguous copy
+// Same digest as nano_sha3_256 over their concatenation: fragments are
+// absorbed in order into one context, so a rate block may straddle any
+// number of them. Zero-length fragments are allowed.
+// @param out: output buffer (must be 32 bytes)
+// @param iov: array of n fragments (may be NULL when n is 0)
+// @param n: number of fragments
+void nano_sha3_256_v(uint8_t *out, const struct nano_sha3_iov *iov, size_t n);
+
+// SHA3-256 of exactly 64 bytes (Merkle node: left || right child digests)
+// Same digest as nano_sha3_256(out, input, 64), built as one padded block:
+// a single permutation with no length loop or block buffer.
+// @param out: output buffer (32 bytes, may equal input)
+// @param input: 64-byte node
+void nano_sha3_256_node64(uint8_t *out, const uint8_t *input);
+
+// Hash a whole Merkle level: count 64-byte nodes into count 32-byte digests
+// Linux libraries run 2, 4 or 8 nodes per permutation on the multi-buffer
+// kernels, the Cortex-M55/M85 Helium library 4. out == input is allowed, so
+// a level can be reduced in place
+// (the next level is the first count * 32 bytes of the buffer).
+// @param out: output buffer (count * 32 bytes)
+// @param input: count consecutive 64-byte nodes
+// @param count: number of nodes
+void nano_sha3_256_node64_many(uint8_t *out, const uint8_t *input, size_t count);
+
+// Streaming context for a DMA ping-pong buffer (circular DMA into two halves)
+// Caller-allocated, never touches the heap. Treat as opaque.
+typedef struct {
+    nano_sha3_256_ctx ctx;
+    const uint8_t *buf;
+    size_t half_len;
+    size_t next;
+    size_t half;
+} nano_sha3_256_dma;
+
+// Start hashing the stream a circular DMA writes into buf
+// The DMA fills buf[0, half_len) then buf[half_len, 2 * half_len) and wraps.
+// Whole rate blocks are absorbed in place from the buffer; a partial block
+// at the end of a half waits there for the next one, and only the block
+// that wraps from the end of the buffer to its start is copied (once).
+// A half_len that is a multiple of 136 never copies at all.
+// @param dma: caller-allocated state (overwritten)
+// @param buf: DMA buffer of 2 * half_len bytes
+// @param half_len: bytes per half, at least 136
+// @return 0, or -1 if buf is NULL or half_len is below 136
+int nano_sha3_256_dma_init(nano_sha3_256_dma *dma, const uint8_t *buf, size_t half_len);
+
+// Absorb the half the DMA just completed (half-transfer / transfer-complete)
+// Halves alternate, the first call takes buf[0, half_len). Call it before
+// the DMA wraps back onto that half.
+// @param dma: state from nano_sha3_256_dma_init
+void nano_sha3_256_dma_absorb_half(nano_sha3_256_dma *dma);
+
+// Absorb the last tail_len bytes the DMA wrote into the next half and finish
+// @param dma: state from nano_sha3_256_dma_init (wiped)
+// @param tail_len: bytes written into the next half, 0 to half_len
+// @param out: output buffer (must be 32 bytes)
+void nano_sha3_256_dma_final(nano_sha3_256_dma *dma, size_t tail_len, uint8_t *out);
+
+#ifdef NANO_SHA3_256_COUNTERS
+// Hot-path counters (libraries built with the "counters" feature only)
+// Derived from lengths at the SHA3-256 entry points above (streaming,
+// midstate, scatter-gather, node64, DMA); SHAKE and KMAC are not counted.
+// The one-shot nano_sha3_256 is counted only where the library has its own
+// permutation (intel_x64, aarch64, the _fast / _ram / _lowram / _asm / _mve
+// variants); on cortex_m0 / m4 / m33 and arm_linux it is the core crate's.
+// Cycles need "counter_cycles": rdtsc on x86_64, DWT->CYCCNT on Cortex-M3
+// and up (enabled by the firmware), 0 elsewhere. Library-wide totals are
+// 32-bit and wrap on Cortex-M.
+typedef struct {
+    uint64_t permutations;    // Keccak-f[1600] calls
+    uint64_t full_blocks;     // 136-byte rate blocks absorbed
+    uint64_t partial_blocks;  // padded final blocks
+    uint64_t bytes;           // message bytes absorbed
+    uint64_t cycles;          // cycles inside the library, 0 without a cycle source
+} nano_sha3_256_counters;
+
+// Read one context's counters or the library-wide totals
+// A context's counters start at init (or prefix / dma_init), are copied by
+// clone and survive final, so they can be read after the digest is out.
+// @param ctx: streaming context, &dma->ctx for a DMA stream, or NULL for the totals
+// @param out: counter snapshot
+void nano_sha3_256_get_counters(const nano_sha3_256_ctx *ctx, nano_sha3_256_counters *out);
+
+// Zero the library-wide totals (per-context counters are reset by init)
+void nano_sha3_256_reset_counters(void);
+#endif
+
+// Size in bytes of the opaque SHAKE context storage
+#define NANO_SHAKE_CTX_SIZE 216
+
+// SHAKE128 / SHAKE256 XOF context (FIPS 202), caller-allocated, no heap
+// Initialize with nano_shake128_init or nano_shake256_init and keep using the
+// functions of that same variant.
+typedef struct {
+    uint64_t opaque[NANO_SHAKE_CTX_SIZE / 8];
+} nano_shake_ctx;
+
+// Single-call SHAKE128 / SHAKE256
+// @param out: output buffer (out_len bytes, any length)
+// @param out_len: output length in bytes
+// @param input: input data (may be NULL when len is 0)
+// @param len: length of input data in bytes
+void nano_shake128(uint8_t *out, size_t out_len, const uint8_t *input, size_t len);
+void nano_shake256(uint8_t *out, size_t out_len, const uint8_t *input, size_t len);
+
+// Initialize an XOF context (SHAKE128: 168-byte rate, SHAKE256: 136-byte rate)
+// @param ctx: caller-allocated context (overwritten)
+void nano_shake128_init(nano_shake_ctx *ctx);
+void nano_shake256_init(nano_shake_ctx *ctx);
+
+// Absorb the next chunk of input
+// @param ctx: context of the matching variant
+// @param input: input data chunk (may be NULL when len is 0)
+// @param len: length of chunk in bytes
+// @return 0, or -1 (input ignored) once squeezing has started
+int nano_shake128_absorb(nano_shake_ctx *ctx, const uint8_t *input, size_t len);
+int nano_shake256_absorb(nano_shake_ctx *ctx, const uint8_t *input, size_t len);
+
+// Squeeze the next len output bytes; the first call finishes absorbing
+// Output is a single stream: squeezing 10 then 20 bytes gives the same 30
+// bytes as one 30-byte squeeze. Output blocks are computed on demand.
+// @param ctx: context of the matching variant
+// @param out: output buffer (len bytes)
+// @param len: number of bytes to squeeze
+void nano_shake128_squeeze(nano_shake_ctx *ctx, uint8_t *out, size_t len);
+void nano_shake256_squeeze(nano_shake_ctx *ctx, uint8_t *out, size_t len);
+
+// Size in bytes of the opaque KMAC256 context storage
+#define NANO_KMAC256_CTX_SIZE 208
+
+// KMAC256 context (NIST SP 800-185), caller-allocated, no heap
+// A keyed context holds key-derived state: wipe it (or pass it to
+// nano_kmac256_final) when the key is retired.
+typedef struct {
+    uint64_t opaque[NANO_KMAC256_CTX_SIZE / 8];
+} nano_kmac256_ctx;
+
+// Absorb key and customization once into a reusable keyed context
+// @param keyed: caller-allocated context (overwritten)
+// @param key: MAC key K (may be NULL when key_len is 0)
+// @param key_len: key length in bytes
+// @param custom: customization string S (may be NULL when custom_len is 0)
+// @param custom_len: customization string length in bytes
+void nano_kmac256_init(nano_kmac256_ctx *keyed, const uint8_t *key, size_t key_len,
+                       const uint8_t *custom, size_t custom_len);
+
+// KMAC256 of one frame from a keyed context, which is left unchanged
+// Costs only the frame's own permutations, never the key's.
+// @param out: output buffer (out_len bytes, L = 8 * out_len bits)
+// @param out_len: MAC length in bytes (32 or 64 typical)
+// @param keyed: context from nano_kmac256_init
+// @param input: frame bytes (may be NULL when len is 0)
+// @param len: frame length in bytes
+void nano_kmac256(uint8_t *out, size_t out_len, const nano_kmac256_ctx *keyed,
+                  const uint8_t *input, size_t len);
+
+// Incremental frames: clone the keyed context, update, then final
+// @param dst: destination context (overwritten; may equal src)
+// @param src: keyed or in-progress context
+void nano_kmac256_clone(nano_kmac256_ctx *dst, const nano_kmac256_ctx *src);
+
+// @param ctx: cloned context
+// @param input: next frame chunk (may be NULL when len is 0)
+// @param len: chunk length in bytes
+void nano_kmac256_update(nano_kmac256_ctx *ctx, const uint8_t *input, size_t len);
+
+// @param ctx: context to finish (wiped)
+// @param out: output buffer (out_len bytes)
+// @param out_len: MAC length in bytes
+void nano_kmac256_final(nano_kmac256_ctx *ctx, uint8_t *out, size_t out_len);
+
+#if defined(__x86_64__) || defined(_M_X64)
+// Permutation kernels of the x86_64 library (nano_sha3_256 and streaming API)
+#define NANO_SHA3_256_KERNEL_AUTO   0  // Best for this CPU (default)
+#define NANO_SHA3_256_KERNEL_SCALAR 1  // Baseline x86-64, lane-complemented
+#define NANO_SHA3_256_KERNEL_BMI2   2  // BMI1 ANDN + BMI2 RORX (also used on AVX2-only CPUs)
+#define NANO_SHA3_256_KERNEL_AVX512 3  // AVX-512F VPROLVQ/VPTERNLOGQ
+
+// Force a permutation kernel (benchmarks, per-kernel timing runs)
+// Picked once at the first hash otherwise; the NANO_SHA3_256_KERNEL
+// environment variable (scalar, bmi2, avx512) overrides that pick.
+// Safe at any time: all kernels share one state layout, so contexts in flight
+// simply continue on the new kernel.
+// @param kernel: NANO_SHA3_256_KERNEL_* (AUTO re-runs CPU detection)
+// @return 0 on success, -1 if unknown or not supported by this CPU
+int nano_sha3_256_set_kernel(int kernel);
+
+// Kernel in use (resolves it if no hash has run yet)
+// @return NANO_SHA3_256_KERNEL_SCALAR, _BMI2 or _AVX512
+int nano_sha3_256_get_kernel(void);
+
+// Multi-buffer SHA3-256: hash 4 independent messages side by side
+// AVX2 kernel (4 Keccak states in SIMD lanes), scalar fallback without AVX2.
+// Lanes may differ in length; similar lengths keep every lane busy.
+// @param out: 4 output buffers (32 bytes each)
+// @param input: 4 input buffers (entries may be NULL when their len is 0)
+// @param len: 4 input lengths in bytes
+void nano_sha3_256_x4(uint8_t *const out[4], const uint8_t *const input[4], const size_t len[4]);
+
+// Multi-buffer SHA3-256: hash 8 independent messages side by side
+// AVX-512 kernel (VPROLQ/VPTERNLOGQ), falls back to 2x AVX2 or scalar.
+// @param out: 8 output buffers (32 bytes each)
+// @param input: 8 input buffers (entries may be NULL when their len is 0)
+// @param len: 8 input lengths in bytes
+void nano_sha3_256_x8(uint8_t *const out[8], const uint8_t *const input[8], const size_t len[8]);
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+// Permutation kernels of the aarch64 library (nano_sha3_256 and streaming API)
+#define NANO_SHA3_256_KERNEL_AUTO   0  // Best for this CPU (default)
+#define NANO_SHA3_256_KERNEL_SCALAR 1  // Baseline ARMv8-A (BIC chi, ROR rotates)
+#define NANO_SHA3_256_KERNEL_SHA3   4  // ARMv8.2-SHA3 EOR3/RAX1/XAR/BCAX
+
+// Force a permutation kernel (benchmarks, per-kernel timing runs)
+// Picked once at the first hash otherwise; the NANO_SHA3_256_KERNEL
+// environment variable (scalar, sha3) overrides that pick.
+// Safe at any time: all kernels share one state layout.
+// @param kernel: NANO_SHA3_256_KERNEL_* (AUTO re-runs CPU detection)
+// @return 0 on success, -1 if unknown or not supported by this CPU
+int nano_sha3_256_set_kernel(int kernel);
+
+// Kernel in use (resolves it if no hash has run yet)
+// @return NANO_SHA3_256_KERNEL_SCALAR or _SHA3
+int nano_sha3_256_get_kernel(void);
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64) || (defined(__arm__) && defined(__linux__))
+// Multi-buffer SHA3-256: hash 2 independent messages side by side
+// aarch64: NEON kernel on the ARMv8.2-SHA3 instructions (EOR3/RAX1/XAR/BCAX),
+// scalar fallback on cores without FEAT_SHA3.
+// armv7 Linux: both states in 128-bit NEON registers (VSHL/VSRI rotates),
+// scalar fallback on cores without NEON.
+// @param out: 2 output buffers (32 bytes each)
+// @param input: 2 input buffers (entries may be NULL when their len is 0)
+// @param len: 2 input lengths in bytes
+void nano_sha3_256_x2(uint8_t *const out[2], const uint8_t *const input[2], const size_t len[2]);
+#endif
+
+#if defined(__ARM_FEATURE_MVE)
+// Multi-buffer SHA3-256 on the Cortex-M55/M85 Helium library (cortex_m55_mve)
+// 4 states in MVE q registers, bit-interleaved 32-bit elements. Single
+// messages (nano_sha3_256, streaming API) stay on the scalar kernel.
+// Requires the FPU/MVE enabled in CPACR (CP10/CP11) before the first call.
+// @param out: 4 output buffers (32 bytes each)
+// @param input: 4 input buffers (entries may be NULL when their len is 0)
+// @param len: 4 input lengths in bytes
+void nano_sha3_256_x4(uint8_t *const out[4], const uint8_t *const input[4], const size_t len[4]);
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64) || \
+    (defined(__arm__) && defined(__linux__))
+// ParallelHash256 (NIST SP 800-185), Linux libraries only
+// Leaves of block_size bytes are hashed on the multi-buffer kernels above,
+// spread over worker threads. Nothing is allocated apart from spawning the
+// worker threads once per call; each keeps a 16 KiB leaf-digest window on
+// its own stack. If a spawn fails the call finishes on fewer threads.
+// @param out: Output buffer (out_len bytes)
+// @param out_len: Output length in bytes (L = 8 * out_len bits)
+// @param input: Input data (may be NULL when len is 0)
+// @param len: Input length in bytes
+// @param block_size: Leaf size B in bytes (e.g. 8192)
+// @param custom: Customization string S (may be NULL when custom_len is 0)
+// @param custom_len: Customization string length in bytes
+// @param threads: Worker threads, 0 for one per available core
+// @return 0 on success, -1 if block_size is 0
+int nano_parallelhash256(uint8_t *out, size_t out_len, const uint8_t *input, size_t len,
+                         size_t block_size, const uint8_t *custom, size_t custom_len, size_t threads);
+
+// One message of a batch: its bytes and the slot its digest is written to
+typedef struct {
+    const uint8_t *input;  // message bytes (may be NULL when len is 0)
+    size_t len;            // message length in bytes
+    uint8_t *out;          // 32-byte digest slot (must not overlap any input)
+} nano_sha3_256_job;
+
+// SHA3-256 of many independent messages, Linux libraries only
+// Jobs are split into runs of 64 spread over worker threads with work
+// stealing, so messages of very different lengths still keep every core
+// busy. Each run is hashed in length order on the multi-buffer kernels
+// (x8/x4 on x86_64, x2 on ARM) so similar lengths share a permutation.
+// Hashing never touches the heap; the worker threads are spawned per call
+// (the only allocation), so batch thousands of jobs per call.
+// @param jobs: array of n jobs (may be NULL when n is 0)
+// @param n: number of jobs
+// @param threads: Worker threads, 0 for one per available core
+// @return 0 on success, -1 if jobs is NULL with n > 0
+int nano_sha3_256_batch(const nano_sha3_256_job *jobs, size_t n, size_t threads);
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64) || \
+    (defined(__arm__) && defined(__linux__)) || defined(__ARM_FEATURE_MVE)
+// Rate (output block size) in bytes of SHAKE128 and SHAKE256
+#define NANO_SHAKE128_RATE 168
+#define NANO_SHAKE256_RATE 136
+
+// Size in bytes of the 4-way SHAKE context storage
+#define NANO_SHAKE_X4_CTX_SIZE 800
+
+// Four SHAKE128 or SHAKE256 states side by side, caller-allocated, no heap
+// For ML-KEM / ML-DSA matrix expansion: absorb seed || indices once, then
+// squeeze blocks as the rejection sampler needs them. Every squeeze is one
+// lane-parallel permutation on the multi-buffer kernel (AVX2 4-way, NEON
+// 2 x 2-way, Helium 4-way; scalar fallback without the extension). Use the
+// functions of a single variant on a context.
+typedef struct {
+    uint64_t opaque[NANO_SHAKE_X4_CTX_SIZE / 8];
+} nano_shake_x4_ctx;
+
+// Start four XOF streams: absorb one input per lane, all of the same length
+// Overwrites ctx; a single absorb per stream (no incremental input).
+// @param ctx: caller-allocated context (overwritten)
+// @param input: 4 input buffers (entries may be NULL when len is 0)
+// @param len: length in bytes of every input
+void nano_shake128_x4_absorb(nano_shake_x4_ctx *ctx, const uint8_t *const input[4], size_t len);
+void nano_shake256_x4_absorb(nano_shake_x4_ctx *ctx, const uint8_t *const input[4], size_t len);
+
+// Squeeze the next blocks whole output blocks of every lane
+// Each lane is one stream: 1 block then 2 blocks gives the same bytes as
+// 3 blocks at once. Output of lane l goes to out[l] (any alignment).
+// @param ctx: context after the matching absorb
+// @param out: 4 output buffers (blocks * NANO_SHAKE128_RATE or _256_RATE bytes each)
+// @param blocks: number of rate blocks per lane (may be 0)
+void nano_shake128_x4_squeezeblocks(nano_shake_x4_ctx *ctx, uint8_t *const out[4], size_t blocks);
+void nano_shake256_x4_squeezeblocks(nano_shake_x4_ctx *ctx, uint8_t *const out[4], size_t blocks);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
 
-#endif // NANO_SHA3_256_H
\ No newline at end of file
+#endif // NANO_SHA3_256_H
@@ -1,3 +1,6 @@
+#define _GNU_SOURCE
+#include <setjmp.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
@@ -6,83 +9,385 @@
 #include <math.h>
 #include "nano_sha3_256.h"
 
-#define SAMPLES 1000
 #define INPUT_SIZE 64
 
-// Simple dudect-style timing analysis
-int main() {
-    uint8_t input_left[INPUT_SIZE];
-    uint8_t input_right[INPUT_SIZE];
-    uint8_t output[32];
-    
-    // Initialize inputs - left class (all zeros), right class (all ones)
-    memset(input_left, 0x00, INPUT_SIZE);
-    memset(input_right, 0xFF, INPUT_SIZE);
-    
-    // Timing measurements
+// Measurements per batch: inputs and classes are drawn before a batch is
+// timed, so the PRNG never runs between the counter reads
+#define BATCH 10000
+
+// Percentile crops on top of the uncropped test (dudect)
+#define CROPS 32
+#define TESTS (1 + CROPS)
+
+// Tests with fewer samples than this are not reported as max t
+#define ENOUGH_SAMPLES 10000
+
+#if defined(__aarch64__)
+#define ARCH_NAME "AArch64"
+#define X2_KERNEL "ARMv8.2-SHA3"
+#elif defined(__arm__)
+#define ARCH_NAME "ARM Linux"
+#define X2_KERNEL "NEON"
+#else
+#define ARCH_NAME "x86_64"
+#endif
+
+// Counters, best first; reads that trap (no user access) are probed away
+#define COUNTER_PMU 0
+#define COUNTER_TIMER 1
+#define COUNTER_CLOCK 2
+static const char *const counter_names[] = {
+#if defined(__x86_64__)
+    "rdtsc/rdtscp (TSC)", "rdtsc/rdtscp (TSC)",
+#elif defined(__aarch64__)
+    "PMCCNTR_EL0 (cycles)", "CNTVCT_EL0 (generic timer)",
+#else
+    "PMCCNTR (cycles)", "CNTVCT (generic timer)",
+#endif
+    "CLOCK_MONOTONIC (ns)"
+};
+static int counter = COUNTER_PMU;
+// The ARMv7 cycle counter is 32 bits wide, deltas are taken modulo 2^32
+static uint64_t counter_mask = ~0ULL;
+
+static inline uint64_t clock_ticks(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t read_pmu(void) {
+    uint64_t v;
+#if defined(__x86_64__)
+    uint32_t lo, hi;
+    __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    v = ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+    __asm__ volatile("mrs %0, pmccntr_el0" : "=r"(v));
+#else
+    uint32_t c;
+    __asm__ volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(c));
+    v = c;
+#endif
+    return v;
+}
+
+static inline uint64_t read_timer(void) {
+    uint64_t v;
+#if defined(__x86_64__)
+    uint32_t lo, hi;
+    __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    v = ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(v));
+#else
+    __asm__ volatile("mrrc p15, 1, %Q0, %R0, c14" : "=r"(v));
+#endif
+    return v;
+}
+
+// Serialized start: nothing before it may still be in flight
+static inline uint64_t counter_start(void) {
+    if (counter == COUNTER_CLOCK) {
+        return clock_ticks();
+    }
+#if defined(__x86_64__)
+    uint32_t lo, hi;
+    __asm__ volatile("lfence\n\trdtsc\n\tlfence" : "=a"(lo), "=d"(hi) :: "memory");
+    return ((uint64_t)hi << 32) | lo;
+#else
+    __asm__ volatile("isb" ::: "memory");
+    uint64_t v = counter == COUNTER_PMU ? read_pmu() : read_timer();
+    __asm__ volatile("isb" ::: "memory");
+    return v;
+#endif
+}
+
+// Serialized stop: waits for the measured code to retire
+static inline uint64_t counter_stop(void) {
+    if (counter == COUNTER_CLOCK) {
+        return clock_ticks();
+    }
+#if defined(__x86_64__)
+    uint32_t lo, hi, aux;
+    __asm__ volatile("rdtscp\n\tlfence" : "=a"(lo), "=d"(hi), "=c"(aux) :: "memory");
+    return ((uint64_t)hi << 32) | lo;
+#else
+    __asm__ volatile("isb" ::: "memory");
+    uint64_t v = counter == COUNTER_PMU ? read_pmu() : read_timer();
+    __asm__ volatile("isb" ::: "memory");
+    return v;
+#endif
+}
+
+static sigjmp_buf probe_env;
+static void probe_trap(int sig) {
+    (void)sig;
+    siglongjmp(probe_env, 1);
+}
+
+// Pick the first counter userspace may read and that actually advances
+static void probe_counter(void) {
+    struct sigaction sa, old;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = probe_trap;
+    sigaction(SIGILL, &sa, &old);
+    for (counter = COUNTER_PMU; counter < COUNTER_CLOCK; counter++) {
+        if (sigsetjmp(probe_env, 1) == 0) {
+            uint64_t a = counter_start();
+            for (volatile int spin = 0; spin < 1000; spin++) {
+            }
+            if (counter_stop() != a) {
+                break;
+            }
+        }
+    }
+    sigaction(SIGILL, &old, NULL);
+#if defined(__arm__)
+    if (counter == COUNTER_PMU) {
+        counter_mask = 0xFFFFFFFFu;
+    }
+#endif
+}
+
+// xorshift64*: class bits and random-class inputs
+static uint64_t rng_state;
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1DULL;
+}
+
+// Welch t-test on online (Welford) accumulators: constant memory for any n
+typedef struct {
+    double n[2];
+    double mean[2];
+    double m2[2];
+} welch_t;
+
+static void welch_push(welch_t *t, double x, int cls) {
+    t->n[cls] += 1;
+    double delta = x - t->mean[cls];
+    t->mean[cls] += delta / t->n[cls];
+    t->m2[cls] += delta * (x - t->mean[cls]);
+}
+
+static double welch_compute(const welch_t *t) {
+    if (t->n[0] < 2 || t->n[1] < 2) {
+        return 0;
+    }
+    double var0 = t->m2[0] / (t->n[0] - 1);
+    double var1 = t->m2[1] / (t->n[1] - 1);
+    double den = sqrt(var0 / t->n[0] + var1 / t->n[1]);
+    return den > 0 ? (t->mean[0] - t->mean[1]) / den : 0;
+}
+
+// APIs under test; KMAC256 MACs the input from one fixed keyed context
+#define API_ONESHOT 0
+#define API_KMAC 1
+#define API_X2 2
+#if defined(__arm__) || defined(__aarch64__)
+#define API_COUNT 3
+#else
+#define API_COUNT 2
+#endif
+static const char *const api_names[] = {
+    "nano_sha3_256", "nano_kmac256 (keyed context)",
+#if defined(__arm__) || defined(__aarch64__)
+    "nano_sha3_256_x2 (" X2_KERNEL ")"
+#endif
+};
+static nano_kmac256_ctx kmac_keyed;
+
+static void run_api(int api, const uint8_t *input) {
+    uint8_t digest[2][32];
+    if (api == API_KMAC) {
+        nano_kmac256(digest[0], 32, &kmac_keyed, input, INPUT_SIZE);
+#if defined(__arm__) || defined(__aarch64__)
+    } else if (api == API_X2) {
+        uint8_t *out[2] = { digest[0], digest[1] };
+        const uint8_t *in[2] = { input, input };
+        const size_t len[2] = { INPUT_SIZE, INPUT_SIZE };
+        nano_sha3_256_x2(out, in, len);
+#endif
+    } else {
+        nano_sha3_256(digest[0], input, INPUT_SIZE);
+    }
+}
+
+static int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint8_t inputs[BATCH][INPUT_SIZE];
+static uint8_t classes[BATCH];
+static uint64_t ticks[BATCH];
+
+static void prepare_batch(void) {
+    for (int i = 0; i < BATCH; i++) {
+        classes[i] = (uint8_t)(rng_next() >> 63);
+        for (int b = 0; b < INPUT_SIZE; b += 8) {
+            // Class 0: fixed all-zero input, class 1: fresh random input
+            uint64_t word = classes[i] ? rng_next() : 0;
+            memcpy(&inputs[i][b], &word, 8);
+        }
+    }
+}
+
+static void measure_batch(int api) {
+    for (int i = 0; i < BATCH; i++) {
+        uint64_t start = counter_start();
+        run_api(api, inputs[i]);
+        ticks[i] = (counter_stop() - start) & counter_mask;
+    }
+}
+
+// One API: a warm-up batch sets the crop thresholds, then `samples`
+// measurements feed the uncropped and CROPS cropped tests
+static double dudect_api(int api, uint64_t samples, double *mean_ticks) {
+    welch_t tests[TESTS];
+    double thresholds[CROPS];
+    memset(tests, 0, sizeof(tests));
+
+    prepare_batch();
+    measure_batch(api);
+    qsort(ticks, BATCH, sizeof(ticks[0]), compare_u64);
+    for (int k = 0; k < CROPS; k++) {
+        double p = 1 - pow(0.5, 10.0 * (k + 1) / CROPS);
+        thresholds[k] = (double)ticks[(size_t)(p * (BATCH - 1))];
+    }
+
+    for (uint64_t done = 0; done < samples; done += BATCH) {
+        prepare_batch();
+        measure_batch(api);
+        int n = samples - done < BATCH ? (int)(samples - done) : BATCH;
+        for (int i = 0; i < n; i++) {
+            double x = (double)ticks[i];
+            welch_push(&tests[0], x, classes[i]);
+            for (int k = 0; k < CROPS; k++) {
+                if (x < thresholds[k]) {
+                    welch_push(&tests[1 + k], x, classes[i]);
+                }
+            }
+        }
+    }
+
+    // Largest |t| among tests with enough samples (dudect's max_test)
+    double enough = samples / 10 < ENOUGH_SAMPLES ? samples / 10 : ENOUGH_SAMPLES;
+    double max_t = 0;
+    int max_test = 0;
+    for (int k = 0; k < TESTS; k++) {
+        double t = fabs(welch_compute(&tests[k]));
+        if (tests[k].n[0] + tests[k].n[1] >= enough && t > max_t) {
+            max_t = t;
+            max_test = k;
+        }
+    }
+
+    printf("\n%s:\n", api_names[api]);
+    printf("Fixed class (zeros):  mean=%.2f ticks, n=%.0f\n", tests[0].mean[0], tests[0].n[0]);
+    printf("Random class:         mean=%.2f ticks, n=%.0f\n", tests[0].mean[1], tests[0].n[1]);
+    printf("Uncropped t: %.5f\n", welch_compute(&tests[0]));
+    if (max_test == 0) {
+        printf("max |t| = %.5f (uncropped)\n", max_t);
+    } else {
+        printf("max |t| = %.5f (cropped below %.0f ticks, n=%.0f)\n", max_t, thresholds[max_test - 1],
+               tests[max_test].n[0] + tests[max_test].n[1]);
+    }
+    *mean_ticks = tests[0].mean[0];
+    return max_t;
+}
+
+// Merkle node throughput: generic one-shot vs the node64 kernel vs a
+// whole level per call (NODE_LEVEL nodes, best of NODE_REPS runs)
+#define NODE_LEVEL 1024
+#define NODE_REPS 20
+
+static void bench_node64(void) {
+    static uint8_t level[NODE_LEVEL * 64];
+    static uint8_t digests[NODE_LEVEL * 32];
+    static const char *const apis[] = {"nano_sha3_256", "nano_sha3_256_node64", "nano_sha3_256_node64_many"};
     struct timespec start, end;
-    long times_left[SAMPLES];
-    long times_right[SAMPLES];
-    
-    printf("Running dudect-style timing analysis...\n");
-    printf("Samples: %d, Input size: %d bytes\n", SAMPLES, INPUT_SIZE);
-    
-    // Measure left class (all zeros)
-    for (int i = 0; i < SAMPLES; i++) {
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        nano_sha3_256(output, input_left, INPUT_SIZE);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        
-        times_left[i] = (end.tv_sec - start.tv_sec) * 1000000000L +
-                       (end.tv_nsec - start.tv_nsec);
-    }
-    
-    // Measure right class (all ones)
-    for (int i = 0; i < SAMPLES; i++) {
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        nano_sha3_256(output, input_right, INPUT_SIZE);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        
-        times_right[i] = (end.tv_sec - start.tv_sec) * 1000000000L +
-                        (end.tv_nsec - start.tv_nsec);
-    }
-    
-    // Calculate statistics
-    double mean_left = 0, mean_right = 0;
-    for (int i = 0; i < SAMPLES; i++) {
-        mean_left += times_left[i];
-        mean_right += times_right[i];
-    }
-    mean_left /= SAMPLES;
-    mean_right /= SAMPLES;
-    
-    // Calculate standard deviations
-    double var_left = 0, var_right = 0;
-    for (int i = 0; i < SAMPLES; i++) {
-        var_left += (times_left[i] - mean_left) * (times_left[i] - mean_left);
-        var_right += (times_right[i] - mean_right) * (times_right[i] - mean_right);
-    }
-    var_left /= (SAMPLES - 1);
-    var_right /= (SAMPLES - 1);
-    
-    double std_left = sqrt(var_left);
-    double std_right = sqrt(var_right);
-    
-    // Simple t-test approximation
-    double pooled_std = sqrt((var_left + var_right) / 2);
-    double t_stat = fabs(mean_left - mean_right) / (pooled_std * sqrt(2.0 / SAMPLES));
-    
-    printf("\nTiming Analysis Results:\n");
-    printf("Left class (zeros):  mean=%.2f ns, std=%.2f ns\n", mean_left, std_left);
-    printf("Right class (ones):  mean=%.2f ns, std=%.2f ns\n", mean_right, std_right);
-    printf("Difference: %.2f ns (%.2f%%)\n",
-           fabs(mean_left - mean_right),
-           100.0 * fabs(mean_left - mean_right) / ((mean_left + mean_right) / 2));
-    printf("T-statistic: %.5f\n", t_stat);
-    
+    double ns[3];
+
+    for (size_t i = 0; i < sizeof(level); i++) {
+        level[i] = (uint8_t)i;
+    }
+    // Best repetition per API, so scheduler noise does not pick the winner
+    for (int api = 0; api < 3; api++) {
+        ns[api] = 1e300;
+        for (int rep = 0; rep < NODE_REPS; rep++) {
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            if (api == 2) {
+                nano_sha3_256_node64_many(digests, level, NODE_LEVEL);
+            } else {
+                for (int n = 0; n < NODE_LEVEL; n++) {
+                    if (api == 0) {
+                        nano_sha3_256(digests + 32 * n, level + 64 * n, 64);
+                    } else {
+                        nano_sha3_256_node64(digests + 32 * n, level + 64 * n);
+                    }
+                }
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            double per_node = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / NODE_LEVEL;
+            if (per_node < ns[api]) {
+                ns[api] = per_node;
+            }
+        }
+    }
+
+    printf("\nMerkle nodes (64-byte input, %d-node level):\n", NODE_LEVEL);
+    for (int api = 0; api < 3; api++) {
+        printf("%-26s %.2f ns/node (%.2fx)\n", apis[api], ns[api], ns[0] / ns[api]);
+    }
+}
+
+// dudect analysis: argv[1] = measurements per API (default 1,000,000)
+int main(int argc, char **argv) {
+    uint64_t samples = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+    if (samples < 2 * BATCH) {
+        samples = 2 * BATCH;
+    }
+    rng_state = (uint64_t)time(NULL) ^ ((uint64_t)clock_ticks() << 20) ^ 0x9E3779B97F4A7C15ULL;
+    probe_counter();
+
+    printf("Running dudect timing analysis on " ARCH_NAME "...\n");
+    printf("Samples: %llu per API, Input size: %d bytes, fixed vs random classes interleaved at random\n",
+           (unsigned long long)samples, INPUT_SIZE);
+    printf("Counter: %s\n", counter_names[counter]);
+#if defined(__x86_64__) || defined(__aarch64__)
+    // Dispatched permutation under test (NANO_SHA3_256_KERNEL forces one)
+    static const char *const kernels[] = {"auto", "scalar", "bmi2", "avx512", "sha3"};
+    printf("Permutation kernel: %s\n", kernels[nano_sha3_256_get_kernel()]);
+#endif
+
+    static const uint8_t kmac_key[32] = {0x40, 0x41, 0x42, 0x43};
+    nano_kmac256_init(&kmac_keyed, kmac_key, sizeof(kmac_key), (const uint8_t *)"telemetry", 9);
+
+    double t_stat = 0;
+    double mean[API_COUNT];
+    for (int api = 0; api < API_COUNT; api++) {
+        double t = dudect_api(api, samples, &mean[api]);
+        if (t > t_stat) {
+            t_stat = t;
+        }
+    }
+
+    printf("\nThroughput (%d-byte messages, %s):\n", INPUT_SIZE, counter_names[counter]);
+    printf("nano_sha3_256:    %.2f ticks/message\n", mean[API_ONESHOT]);
+    printf("nano_kmac256:     %.2f ticks/message\n", mean[API_KMAC]);
+#if defined(__arm__) || defined(__aarch64__)
+    // Two messages per x2 call
+    printf("nano_sha3_256_x2: %.2f ticks/message (%.2fx)\n", mean[API_X2] / 2, 2 * mean[API_ONESHOT] / mean[API_X2]);
+#endif
+    bench_node64();
+
     // Dudect-style output format
-    printf("\nmax t = %.5f, n == %dK\n", t_stat, SAMPLES / 1000);
-    
+    printf("\nmax t = %.5f, n == %lluK\n", t_stat, (unsigned long long)(samples / 1000));
+
     if (t_stat < 5.0) {
         printf("✅ PASS: Constant-time behavior (|t| = %.5f < 5.0)\n", t_stat);
         return 0;